@@ -17,15 +17,67 @@
 //
 // Features:
 // - vec_<T>_init:      Initialize a new vector.
+// - vec_<T>_init_with_allocator: Initialize with a custom allocator.
 // - vec_<T>_capacity:  Get current capacity.
 // - vec_<T>_len:       Get current number of elements.
 // - vec_<T>_resize:    Resize internal buffer.
+// - vec_<T>_reserve:   Guarantee a total capacity up front.
+// - vec_<T>_try_resize/try_reserve/try_push/try_push_n:
+//                      Status-returning variants that report VECTOR_ERR_OOM
+//                      instead of exiting, leaving the vector intact.
 // - vec_<T>_ensure:    Ensure capacity for N extra items.
 // - vec_<T>_push:      Push a value to the end.
+// - vec_<T>_push_n:    Bulk-append N values with a single memcpy.
+// - vec_<T>_extend:    Append all elements of another vector.
 // - vec_<T>_set:       Set value at index.
 // - vec_<T>_get:       Get value at index.
+// - vec_<T>_set_unchecked: Set without bounds checking (hot loops).
+// - vec_<T>_get_unchecked: Get without bounds checking (hot loops).
+// - vec_<T>_at:        Get a pointer to an element, NULL if out of bounds.
+// - vec_<T>_data:      Raw pointer to the underlying buffer.
+// - vec_<T>_insert:    Insert at an index with a single memmove.
+// - vec_<T>_insert_n:  Insert N values at an index (memmove + memcpy).
+// - vec_<T>_splice:    Insert another vector's elements at an index.
+// - vec_<T>_swap_remove: O(1) removal by moving the last element in.
+// - vec_<T>_remove_if: Single-pass compaction with a predicate.
 // - vec_<T>_for_each:  Iterate with a callback.
+// - vec_<T>_for_each_ctx: Iterate by pointer with a context and early exit.
+// - vec_<T>_find:      Find the first element matching a predicate.
+// - vec_<T>_map_to / filter_to / reduce: Typed transformation passes.
+// - vec_<T>_gather:    Indexed bulk reads that software-prefetch ahead
+//                      of the index stream; checked, unchecked, and
+//                      callback variants.
+// - DEFINE_SOA_VECTOR_2/_3: Struct-of-arrays vectors — parallel
+//                     per-field columns sharing one length/capacity,
+//                     with per-field data/get/for_each accessors.
+// - DEFINE_VECTOR_POD / DEFINE_VECTOR_BIG: Per-instantiation knob for
+//                     element size; BIG adds by-reference push/set/
+//                     insert, in-place emplace, and pop_into so large
+//                     structs never cross the call ABI by value.
+// - vec_<T>_destroy_batch: Teardown that hands the whole element
+//                          buffer to one bulk free callback.
+// - vector_freelist_t: Intrusive recycler so pointer payloads skip
+//                      malloc on pop+push churn.
+// - DEFINE_BITVECTOR: Bit-packed bool vectors (64 bits per word) with
+//                     word-level and/or/not and popcount-based counting.
+// - vec_<T>_pipeline:  Run several map/filter stages fused into one
+//                      pass over the data (one load/store per element).
+// - vec_<T>_slice:     Zero-copy view of a subrange, with slice-based
+//                      for_each/find/sort and vec_<T>_push_slice.
+//                      Views borrow the buffer: they are invalidated by
+//                      growth and write through to shared snapshots.
+// - vec_<T>_sort:      Sort in place with a qsort-style comparator.
+// - vec_<T>_lower_bound: First index whose element is not less than key.
+// - vec_<T>_binary_search: Find a key in a sorted vector.
+// - vec_<T>_insert_sorted: Insert keeping sorted order (one memmove).
 // - vec_<T>_clear:     Reset length to 0.
+// - vec_<T>_shrink_to_fit: Trim capacity down to the current length.
+// - vec_<T>_clear_release: Reset length and trim capacity in one call.
+// - vec_<T>_take:      Steal the raw buffer, leaving the vector empty.
+// - vec_<T>_move:      Transfer ownership between vectors, O(1).
+// - vec_<T>_adopt:     Wrap an existing allocation without copying.
+// - vec_<T>_snapshot:  O(1) copy-on-write snapshot sharing the buffer.
+// - vec_<T>_detach:    Force a snapshot-sharing vector to own its buffer.
 // - vec_<T>_destroy:   Free memory (+ optional cleanup).
 //
 // Usage:
@@ -40,12 +92,34 @@
 // Pro tip: Use `generic` for `void*` style:
 //     vec_generic_push(&v, ptr); // Works with malloc-ed ptrs
 //
+// Small vectors (no malloc until the inline slots overflow):
+//     DEFINE_SMALL_VECTOR(int, tags, 8); // 8 inline slots
+//     small_vector_tags_t t;
+//     vec_tags_init(&t, 2.0); // No heap allocation here
+//     vec_tags_push(&t, 42);  // Spills to the heap past 8 elements
+// Note: small vectors point into their own struct, so they must not
+// be copied by assignment or passed by value.
+//
+// SIMD-aligned vectors (alignment preserved across growth):
+//     DEFINE_VECTOR_ALIGNED(float, f32, 64); // 64-byte aligned buffer
+//     vector_f32_t v;
+//     vec_f32_init_aligned(&v, 1024, 2.0);
+//     // vec_f32_data(&v) is always 64-byte aligned
+//
+// Copy-on-write snapshots (O(1) instead of a full copy):
+//     vector_f64_t snap;
+//     vec_f64_snapshot(&column, &snap); // Shares the buffer, refcounted
+//     vec_f64_push(&column, 1.0);       // First write clones lazily
+// Note: the refcount is not atomic — snapshot/mutate/destroy of vectors
+// sharing one buffer must happen on a single thread. The _unchecked
+// setters bypass copy-on-write on purpose; detach first in hot loops.
+//
 // All vectors follow the same pattern, just swap `int`, `float`, etc.
 // ----------------------------------------
 // Initial revision: 2025-05-24
-// Last updated:     2025-06-05
+// Last updated:     2026-09-01
 // ----------------------------------------
-// Depends on: stdlib.h, stdio.h
+// Depends on: stdlib.h, stdio.h, string.h
 // ----------------------------------------
 
 #ifndef FLUENT_LIBC_VECTOR_LIBRARY_H
@@ -61,12 +135,385 @@ extern "C" // C++ linkage
 
 // == IMPORTS ==
 #include <stdlib.h> // For malloc and free
+#include <string.h> // For memcpy
+#include <stdint.h> // For uintptr_t
 #ifndef FLUENT_LIBC_RELEASE
 #   include <types.h>
 #else
 #   include <fluent/types/types.h>
 #endif
 
+// == PLATFORM DETECTION ==
+// POSIX-only features (mmap, serialization, yielding spin waits,
+// huge-page hints) are compiled in only when the platform and the
+// feature-test macros actually expose POSIX declarations.
+#if !defined(_WIN32) && (defined(_GNU_SOURCE) || defined(_DEFAULT_SOURCE) \
+    || (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 199309L) || defined(__APPLE__))
+#   define FLUENT_LIBC_VECTOR_HAS_POSIX 1
+#endif
+
+// Software prefetch hint for pointer-chasing access patterns (read
+// intent, low temporal locality); a no-op where the builtin is
+// unavailable. GATHER_AHEAD is how many indices the gather loop runs
+// ahead of use — far enough to cover a main-memory miss, close enough
+// not to evict lines before they are consumed.
+#if defined(__GNUC__) || defined(__clang__)
+#   define FLUENT_VEC_PREFETCH(addr) __builtin_prefetch((addr), 0, 1)
+#else
+#   define FLUENT_VEC_PREFETCH(addr) ((void)0)
+#endif
+
+#ifndef FLUENT_LIBC_VECTOR_GATHER_AHEAD
+#   define FLUENT_LIBC_VECTOR_GATHER_AHEAD 8
+#endif
+
+// == ERROR CODES ==
+// Returned by the vec_<NAME>_try_* entry points, which report failures
+// instead of printing and exiting. On error the vector is left intact.
+#ifndef FLUENT_LIBC_VECTOR_ERROR_DEFINED
+#   define FLUENT_LIBC_VECTOR_ERROR_DEFINED 1
+    typedef enum
+    {
+        VECTOR_OK = 0,
+        VECTOR_ERR_OOM = 1,
+        VECTOR_ERR_IO = 2,
+        VECTOR_ERR_FORMAT = 3
+    } vector_error_t;
+#endif
+
+// == ALLOCATOR ==
+// Allocation vtable shared by every DEFINE_VECTOR instantiation.
+// The context pointer is passed through untouched, so arenas and
+// pools can carve vector buffers out of their own memory.
+#ifndef FLUENT_LIBC_VECTOR_ALLOCATOR_DEFINED
+#   define FLUENT_LIBC_VECTOR_ALLOCATOR_DEFINED 1
+    typedef struct
+    {
+        void *(*alloc)(size_t size, void *ctx);
+        void *(*realloc)(void *ptr, size_t size, void *ctx);
+        void (*free)(void *ptr, void *ctx);
+        void *ctx;
+    } vector_allocator_t;
+
+    static inline void *vector_libc_alloc(const size_t size, void *ctx)
+    {
+        (void)ctx;
+        return malloc(size);
+    }
+
+    static inline void *vector_libc_realloc(void *ptr, const size_t size, void *ctx)
+    {
+        (void)ctx;
+        return realloc(ptr, size);
+    }
+
+    static inline void vector_libc_free(void *ptr, void *ctx)
+    {
+        (void)ctx;
+        free(ptr);
+    }
+
+    static inline vector_allocator_t vector_libc_allocator(void)
+    {
+        vector_allocator_t allocator;
+        allocator.alloc = vector_libc_alloc;
+        allocator.realloc = vector_libc_realloc;
+        allocator.free = vector_libc_free;
+        allocator.ctx = NULL;
+        return allocator;
+    }
+#endif
+
+// == STATS (opt-in) ==
+// Compile with -DFLUENT_LIBC_VECTOR_STATS to count, per vector and
+// process-wide, the behavior that causes production mysteries:
+// reallocs, bytes copied by growth, peak capacity and push counts.
+// vec_<NAME>_stats fills a vec_stats_t (always defined, so callers
+// compile in both modes); vector_stats_dump prints the global totals.
+// When the flag is off every hook expands to nothing — zero overhead —
+// and the accessor reports zeroed counters alongside the live
+// length/capacity/waste. The global totals are per translation unit.
+#ifndef FLUENT_LIBC_VECTOR_STATS_DEFINED
+#   define FLUENT_LIBC_VECTOR_STATS_DEFINED 1
+    typedef struct
+    {
+        size_t reallocs;          /* buffer reallocations since init */
+        size_t grow_bytes_copied; /* bytes moved by growth reallocs */
+        size_t peak_capacity;     /* highest capacity ever reached */
+        size_t pushes;            /* elements appended */
+        size_t length;            /* current length */
+        size_t capacity;          /* current capacity */
+        size_t wasted_capacity;   /* capacity - length */
+    } vec_stats_t;
+
+#   ifdef FLUENT_LIBC_VECTOR_STATS
+        static vec_stats_t vector_global_stats;
+
+        static inline void vector_stats_dump(void)
+        {
+            fprintf(stderr, "fluent_libc vector stats: reallocs=%zu grow_bytes_copied=%zu pushes=%zu\n",
+                vector_global_stats.reallocs,
+                vector_global_stats.grow_bytes_copied,
+                vector_global_stats.pushes);
+        }
+
+#       define FLUENT_VEC_STATS_FIELD vec_stats_t stats;
+#       define FLUENT_VEC_STATS_ON_INIT(vector, cap)       \
+            ((vector)->stats.reallocs = 0,                 \
+             (vector)->stats.grow_bytes_copied = 0,        \
+             (vector)->stats.pushes = 0,                   \
+             (vector)->stats.peak_capacity = (cap))
+#       define FLUENT_VEC_STATS_ON_RESIZE(vector, old_cap, new_cap, elem_size) \
+            ((vector)->stats.reallocs++,                   \
+             vector_global_stats.reallocs++,               \
+             (vector)->stats.grow_bytes_copied += ((old_cap) < (new_cap) ? (old_cap) : (new_cap)) * (elem_size), \
+             vector_global_stats.grow_bytes_copied += ((old_cap) < (new_cap) ? (old_cap) : (new_cap)) * (elem_size), \
+             (vector)->stats.peak_capacity = (new_cap) > (vector)->stats.peak_capacity ? (new_cap) : (vector)->stats.peak_capacity)
+#       define FLUENT_VEC_STATS_ON_PUSH(vector, n)         \
+            ((vector)->stats.pushes += (n),                \
+             vector_global_stats.pushes += (n))
+#       define FLUENT_VEC_STATS_READ(vector, out)          \
+            (*(out) = (vector)->stats)
+#   else
+        static inline void vector_stats_dump(void)
+        {
+        }
+
+#       define FLUENT_VEC_STATS_FIELD
+#       define FLUENT_VEC_STATS_ON_INIT(vector, cap) ((void)0)
+#       define FLUENT_VEC_STATS_ON_RESIZE(vector, old_cap, new_cap, elem_size) ((void)0)
+#       define FLUENT_VEC_STATS_ON_PUSH(vector, n) ((void)0)
+#       define FLUENT_VEC_STATS_READ(vector, out)          \
+            ((out)->reallocs = 0,                          \
+             (out)->grow_bytes_copied = 0,                 \
+             (out)->peak_capacity = 0,                     \
+             (out)->pushes = 0)
+#   endif
+#endif
+
+// == GROWTH POLICY ==
+// Per-vector control over how capacity grows. The all-zero default
+// keeps the historical behavior: multiply by growth_factor every time.
+// Giant vectors can cap the geometric phase (double_until) and switch
+// to a fixed element increment, round allocations to whole pages to
+// avoid sub-page waste, and ask the kernel for transparent huge pages
+// to cut TLB misses on scan-heavy buffers.
+#ifndef FLUENT_LIBC_VECTOR_GROWTH_POLICY_DEFINED
+#   define FLUENT_LIBC_VECTOR_GROWTH_POLICY_DEFINED 1
+#   ifndef FLUENT_LIBC_VECTOR_PAGE_SIZE
+#       define FLUENT_LIBC_VECTOR_PAGE_SIZE 4096
+#   endif
+#   define FLUENT_LIBC_VECTOR_HUGE_PAGE_MIN (2u * 1024u * 1024u)
+
+    typedef struct
+    {
+        size_t double_until;      /* capacity (elements) after which geometric growth stops; 0 = never */
+        size_t increment;         /* fixed element increment past double_until; 0 = keep geometric */
+        unsigned char page_round; /* round grown byte sizes up to whole pages */
+        unsigned char huge_pages; /* madvise(MADV_HUGEPAGE) buffers >= 2 MiB (Linux) */
+    } vector_growth_policy_t;
+
+    static inline vector_growth_policy_t vector_default_growth_policy(void)
+    {
+        vector_growth_policy_t policy;
+        policy.double_until = 0;
+        policy.increment = 0;
+        policy.page_round = 0;
+        policy.huge_pages = 0;
+        return policy;
+    }
+
+    static inline size_t vector_next_capacity(
+        const size_t current,
+        const size_t needed,
+        const double growth_factor,
+        const vector_growth_policy_t *policy,
+        const size_t element_size
+    )
+    {
+        size_t new_capacity = current;
+
+        while (new_capacity < needed)
+        {
+            size_t grown;
+
+            if (policy->double_until != 0 && policy->increment != 0 && new_capacity >= policy->double_until)
+            {
+                grown = new_capacity + policy->increment;
+            }
+            else
+            {
+                grown = (size_t)(new_capacity * growth_factor);
+            }
+
+            new_capacity = grown > new_capacity ? grown : needed;
+        }
+
+        if (policy->page_round)
+        {
+            const size_t bytes = new_capacity * element_size;
+            const size_t rounded = (bytes + FLUENT_LIBC_VECTOR_PAGE_SIZE - 1)
+                & ~((size_t)FLUENT_LIBC_VECTOR_PAGE_SIZE - 1);
+            new_capacity = rounded / element_size;
+        }
+
+        return new_capacity;
+    }
+
+#   if defined(FLUENT_LIBC_VECTOR_HAS_POSIX) && defined(__linux__)
+#       include <sys/mman.h>
+        static inline void vector_hint_huge_pages(void *ptr, const size_t bytes)
+        {
+#           ifdef MADV_HUGEPAGE
+                /* madvise wants page-aligned bounds; shrink to the aligned interior */
+                const uintptr_t start = ((uintptr_t)ptr + FLUENT_LIBC_VECTOR_PAGE_SIZE - 1)
+                    & ~((uintptr_t)FLUENT_LIBC_VECTOR_PAGE_SIZE - 1);
+                const uintptr_t end = ((uintptr_t)ptr + bytes)
+                    & ~((uintptr_t)FLUENT_LIBC_VECTOR_PAGE_SIZE - 1);
+
+                if (bytes >= FLUENT_LIBC_VECTOR_HUGE_PAGE_MIN && end > start)
+                {
+                    madvise((void *)start, end - start, MADV_HUGEPAGE);
+                }
+#           else
+                (void)ptr;
+                (void)bytes;
+#           endif
+        }
+#   else
+        static inline void vector_hint_huge_pages(void *ptr, const size_t bytes)
+        {
+            (void)ptr;
+            (void)bytes;
+        }
+#   endif
+#endif
+
+// == ALIGNED ALLOCATOR ==
+// Over-aligned allocation built on malloc so alignment survives growth:
+// realloc cannot preserve alignment, so grown buffers are re-aligned
+// and copied. A small header before each aligned block records the raw
+// pointer and the block size. The requested alignment travels in the
+// allocator context pointer (it must be a power of two).
+#ifndef FLUENT_LIBC_VECTOR_ALIGNED_ALLOCATOR_DEFINED
+#   define FLUENT_LIBC_VECTOR_ALIGNED_ALLOCATOR_DEFINED 1
+    static inline void *vector_aligned_alloc(const size_t size, void *ctx)
+    {
+        size_t alignment = (size_t)(uintptr_t)ctx;
+
+        if (alignment < sizeof(void *))
+        {
+            alignment = sizeof(void *);
+        }
+
+        unsigned char *raw = (unsigned char *)malloc(size + alignment + 2 * sizeof(void *));
+
+        if (raw == NULL)
+        {
+            return NULL;
+        }
+
+        uintptr_t addr = (uintptr_t)(raw + 2 * sizeof(void *));
+        addr = (addr + alignment - 1) & ~((uintptr_t)alignment - 1);
+
+        void **block = (void **)addr;
+        block[-1] = raw;
+        block[-2] = (void *)(uintptr_t)size;
+        return (void *)addr;
+    }
+
+    static inline void vector_aligned_free(void *ptr, void *ctx)
+    {
+        (void)ctx;
+
+        if (ptr != NULL)
+        {
+            free(((void **)ptr)[-1]);
+        }
+    }
+
+    static inline void *vector_aligned_realloc(void *ptr, const size_t size, void *ctx)
+    {
+        void *new_block = vector_aligned_alloc(size, ctx);
+
+        if (new_block == NULL || ptr == NULL)
+        {
+            return new_block;
+        }
+
+        const size_t old_size = (size_t)(uintptr_t)((void **)ptr)[-2];
+        memcpy(new_block, ptr, old_size < size ? old_size : size);
+        vector_aligned_free(ptr, ctx);
+        return new_block;
+    }
+
+    static inline vector_allocator_t vector_aligned_allocator(const size_t alignment)
+    {
+        vector_allocator_t allocator;
+        allocator.alloc = vector_aligned_alloc;
+        allocator.realloc = vector_aligned_realloc;
+        allocator.free = vector_aligned_free;
+        allocator.ctx = (void *)(uintptr_t)alignment;
+        return allocator;
+    }
+#endif
+
+// == FREE LISTS ==
+// Intrusive LIFO recycler for pointer payloads (vector_generic_t and
+// friends): released blocks are threaded through their own first
+// pointer-sized bytes, so pop+push cycles can reuse payload memory
+// without touching malloc. Blocks must be at least sizeof(void *)
+// bytes and all the same size. Drain hands every cached block back to
+// the caller's free function on teardown.
+typedef struct
+{
+    void *head;
+    size_t count;
+} vector_freelist_t;
+
+static inline void vector_freelist_init(vector_freelist_t *freelist)
+{
+    freelist->head = NULL;
+    freelist->count = 0;
+}
+
+static inline void vector_freelist_release(vector_freelist_t *freelist, void *block)
+{
+    *(void **)block = freelist->head;
+    freelist->head = block;
+    freelist->count++;
+}
+
+static inline void *vector_freelist_acquire(vector_freelist_t *freelist)
+{
+    if (freelist->head == NULL)
+    {
+        return NULL;
+    }
+
+    void *block = freelist->head;
+    freelist->head = *(void **)block;
+    freelist->count--;
+    return block;
+}
+
+static inline size_t vector_freelist_len(const vector_freelist_t *freelist)
+{
+    return freelist->count;
+}
+
+static inline void vector_freelist_drain(vector_freelist_t *freelist, void (*free_fn)(void *block))
+{
+    while (freelist->head != NULL)
+    {
+        void *next = *(void **)freelist->head;
+        free_fn(freelist->head);
+        freelist->head = next;
+    }
+
+    freelist->count = 0;
+}
+
 #define DEFINE_VECTOR(V, NAME)                             \
     typedef struct                                         \
     {                                                      \
@@ -74,12 +521,30 @@ extern "C" // C++ linkage
         size_t capacity;                                   \
         double growth_factor;                              \
         V *data;                                           \
+        vector_allocator_t allocator;                      \
+        size_t *cow_refs;                                  \
+        vector_growth_policy_t growth_policy;              \
+        FLUENT_VEC_STATS_FIELD                             \
     } vector_##NAME##_t;                                   \
                                                            \
-    static inline void vec_##NAME##_init(                  \
+    typedef struct                                         \
+    {                                                      \
+        V *data;                                           \
+        size_t length;                                     \
+    } vec_##NAME##_slice_t;                                \
+                                                           \
+    typedef struct                                         \
+    {                                                      \
+        V (*map_fn)(V value, void *ctx);                   \
+        int (*filter_fn)(V *value, size_t index, void *ctx); \
+        void *ctx;                                         \
+    } vec_##NAME##_stage_t;                                \
+                                                           \
+    static inline void vec_##NAME##_init_with_allocator(   \
         vector_##NAME##_t *vector,                         \
-        const size_t initial_capacity,                      \
-        const double growth_factor                         \
+        const size_t initial_capacity,                     \
+        const double growth_factor,                        \
+        const vector_allocator_t allocator                 \
     )                                                      \
     {                                                      \
         if (initial_capacity == 0)                         \
@@ -91,7 +556,11 @@ extern "C" // C++ linkage
         vector->length = 0;                                \
         vector->capacity = initial_capacity;               \
         vector->growth_factor = growth_factor;             \
-        vector->data = (V *)malloc(sizeof(V) * initial_capacity); \
+        vector->allocator = allocator;                     \
+        vector->cow_refs = NULL;                           \
+        vector->growth_policy = vector_default_growth_policy(); \
+        FLUENT_VEC_STATS_ON_INIT(vector, initial_capacity); \
+        vector->data = (V *)allocator.alloc(sizeof(V) * initial_capacity, allocator.ctx); \
                                                            \
         if (vector->data == NULL)                          \
         {                                                  \
@@ -100,6 +569,23 @@ extern "C" // C++ linkage
         }                                                  \
     }                                                      \
                                                            \
+    static inline void vec_##NAME##_init(                  \
+        vector_##NAME##_t *vector,                         \
+        const size_t initial_capacity,                      \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_init_with_allocator(vector, initial_capacity, growth_factor, vector_libc_allocator()); \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_set_growth_policy(     \
+        vector_##NAME##_t *vector,                         \
+        const vector_growth_policy_t policy                \
+    )                                                      \
+    {                                                      \
+        vector->growth_policy = policy;                    \
+    }                                                      \
+                                                           \
     static inline size_t vec_##NAME##_capacity(            \
         vector_##NAME##_t *vector                          \
     )                                                      \
@@ -114,33 +600,157 @@ extern "C" // C++ linkage
         return vector->length;                             \
     }                                                      \
                                                            \
+    static inline vector_error_t vec_##NAME##_try_detach(  \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        if (vector->cow_refs == NULL)                      \
+        {                                                  \
+            return VECTOR_OK;                              \
+        }                                                  \
+                                                           \
+        if (*vector->cow_refs == 1)                        \
+        {                                                  \
+            vector->allocator.free(vector->cow_refs, vector->allocator.ctx); \
+            vector->cow_refs = NULL;                       \
+            return VECTOR_OK;                              \
+        }                                                  \
+                                                           \
+        V *clone = (V *)vector->allocator.alloc(sizeof(V) * vector->capacity, vector->allocator.ctx); \
+                                                           \
+        if (clone == NULL)                                 \
+        {                                                  \
+            return VECTOR_ERR_OOM;                         \
+        }                                                  \
+                                                           \
+        memcpy(clone, vector->data, sizeof(V) * vector->length); \
+        (*vector->cow_refs)--;                             \
+        vector->data = clone;                              \
+        vector->cow_refs = NULL;                           \
+        return VECTOR_OK;                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_detach(                \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        if (vec_##NAME##_try_detach(vector) != VECTOR_OK)  \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_snapshot(              \
+        vector_##NAME##_t *src,                            \
+        vector_##NAME##_t *dst                             \
+    )                                                      \
+    {                                                      \
+        if (src->cow_refs == NULL)                         \
+        {                                                  \
+            src->cow_refs = (size_t *)src->allocator.alloc(sizeof(size_t), src->allocator.ctx); \
+                                                           \
+            if (src->cow_refs == NULL)                     \
+            {                                              \
+                fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+                exit(1);                                   \
+            }                                              \
+                                                           \
+            *src->cow_refs = 1;                            \
+        }                                                  \
+                                                           \
+        (*src->cow_refs)++;                                \
+        *dst = *src;                                       \
+    }                                                      \
+                                                           \
     static inline void vec_##NAME##_resize(                \
         vector_##NAME##_t *vector,                         \
         const size_t new_capacity                          \
     )                                                      \
     {                                                      \
-        V* new_data = (V *)realloc(vector->data, sizeof(V) * new_capacity); \
+        vec_##NAME##_detach(vector);                       \
+        V* new_data = (V *)vector->allocator.realloc(vector->data, sizeof(V) * new_capacity, vector->allocator.ctx); \
                                                            \
         if (new_data == NULL)                              \
         {                                                  \
-            free(vector->data);                            \
+            vector->allocator.free(vector->data, vector->allocator.ctx); \
             fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
             exit(1);                                       \
         }                                                  \
                                                            \
+        FLUENT_VEC_STATS_ON_RESIZE(vector, vector->capacity, new_capacity, sizeof(V)); \
         vector->data = new_data;                           \
         vector->capacity = new_capacity;                   \
+                                                           \
+        if (vector->growth_policy.huge_pages)              \
+        {                                                  \
+            vector_hint_huge_pages(new_data, sizeof(V) * new_capacity); \
+        }                                                  \
     }                                                      \
                                                            \
-    static inline void vec_##NAME##_ensure(                \
+    static inline vector_error_t vec_##NAME##_try_resize(  \
         vector_##NAME##_t *vector,                         \
-        const size_t n                                     \
+        const size_t new_capacity                          \
+    )                                                      \
+    {                                                      \
+        const vector_error_t detach_err = vec_##NAME##_try_detach(vector); \
+                                                           \
+        if (detach_err != VECTOR_OK)                       \
+        {                                                  \
+            return detach_err;                             \
+        }                                                  \
+                                                           \
+        V* new_data = (V *)vector->allocator.realloc(vector->data, sizeof(V) * new_capacity, vector->allocator.ctx); \
+                                                           \
+        if (new_data == NULL)                              \
+        {                                                  \
+            return VECTOR_ERR_OOM;                         \
+        }                                                  \
+                                                           \
+        FLUENT_VEC_STATS_ON_RESIZE(vector, vector->capacity, new_capacity, sizeof(V)); \
+        vector->data = new_data;                           \
+        vector->capacity = new_capacity;                   \
+                                                           \
+        if (vector->growth_policy.huge_pages)              \
+        {                                                  \
+            vector_hint_huge_pages(new_data, sizeof(V) * new_capacity); \
+        }                                                  \
+                                                           \
+        return VECTOR_OK;                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_reserve(               \
+        vector_##NAME##_t *vector,                         \
+        const size_t total_capacity                        \
+    )                                                      \
+    {                                                      \
+        if (total_capacity <= vector->capacity)            \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        vec_##NAME##_resize(vector, vector_next_capacity(vector->capacity, total_capacity, vector->growth_factor, &vector->growth_policy, sizeof(V))); \
+    }                                                      \
+                                                           \
+    static inline vector_error_t vec_##NAME##_try_reserve( \
+        vector_##NAME##_t *vector,                         \
+        const size_t total_capacity                        \
     )                                                      \
     {                                                      \
-        if (vector->length + n > vector->capacity)         \
+        if (total_capacity <= vector->capacity)            \
         {                                                  \
-            vec_##NAME##_resize(vector, vector->capacity * vector->growth_factor); \
+            return VECTOR_OK;                              \
         }                                                  \
+                                                           \
+        return vec_##NAME##_try_resize(vector, vector_next_capacity(vector->capacity, total_capacity, vector->growth_factor, &vector->growth_policy, sizeof(V))); \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_ensure(                \
+        vector_##NAME##_t *vector,                         \
+        const size_t n                                     \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_reserve(vector, vector->length + n);  \
     }                                                      \
                                                            \
     static inline void vec_##NAME##_push(                  \
@@ -148,9 +758,96 @@ extern "C" // C++ linkage
         V value                                            \
     )                                                      \
     {                                                      \
+        vec_##NAME##_detach(vector);                       \
         vec_##NAME##_ensure(vector, 1);                    \
         vector->data[vector->length] = value;              \
         vector->length++;                                  \
+        FLUENT_VEC_STATS_ON_PUSH(vector, 1);               \
+    }                                                      \
+                                                           \
+    static inline vector_error_t vec_##NAME##_try_push(    \
+        vector_##NAME##_t *vector,                         \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        const vector_error_t detach_err = vec_##NAME##_try_detach(vector); \
+                                                           \
+        if (detach_err != VECTOR_OK)                       \
+        {                                                  \
+            return detach_err;                             \
+        }                                                  \
+                                                           \
+        if (vector->length + 1 > vector->capacity)         \
+        {                                                  \
+            const vector_error_t err = vec_##NAME##_try_reserve(vector, vector->length + 1); \
+                                                           \
+            if (err != VECTOR_OK)                          \
+            {                                              \
+                return err;                                \
+            }                                              \
+        }                                                  \
+                                                           \
+        vector->data[vector->length] = value;              \
+        vector->length++;                                  \
+        FLUENT_VEC_STATS_ON_PUSH(vector, 1);               \
+        return VECTOR_OK;                                  \
+    }                                                      \
+                                                           \
+    static inline vector_error_t vec_##NAME##_try_push_n(  \
+        vector_##NAME##_t *vector,                         \
+        const V *src,                                      \
+        const size_t n                                     \
+    )                                                      \
+    {                                                      \
+        if (n == 0)                                        \
+        {                                                  \
+            return VECTOR_OK;                              \
+        }                                                  \
+                                                           \
+        const vector_error_t detach_err = vec_##NAME##_try_detach(vector); \
+                                                           \
+        if (detach_err != VECTOR_OK)                       \
+        {                                                  \
+            return detach_err;                             \
+        }                                                  \
+                                                           \
+        const vector_error_t err = vec_##NAME##_try_reserve(vector, vector->length + n); \
+                                                           \
+        if (err != VECTOR_OK)                              \
+        {                                                  \
+            return err;                                    \
+        }                                                  \
+                                                           \
+        memcpy(vector->data + vector->length, src, sizeof(V) * n); \
+        vector->length += n;                               \
+        FLUENT_VEC_STATS_ON_PUSH(vector, n);               \
+        return VECTOR_OK;                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_push_n(                \
+        vector_##NAME##_t *vector,                         \
+        const V *src,                                      \
+        const size_t n                                     \
+    )                                                      \
+    {                                                      \
+        if (n == 0)                                        \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        vec_##NAME##_detach(vector);                       \
+        vec_##NAME##_reserve(vector, vector->length + n);  \
+        memcpy(vector->data + vector->length, src, sizeof(V) * n); \
+        vector->length += n;                               \
+        FLUENT_VEC_STATS_ON_PUSH(vector, n);               \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_extend(                \
+        vector_##NAME##_t *vector,                         \
+        const vector_##NAME##_t *src                       \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_push_n(vector, (const V *)src->data, src->length); \
     }                                                      \
                                                            \
     static inline void vec_##NAME##_set(                   \
@@ -165,6 +862,7 @@ extern "C" // C++ linkage
             exit(1);                                       \
         }                                                  \
                                                            \
+        vec_##NAME##_detach(vector);                       \
         vector->data[index] = value;                       \
     }                                                      \
                                                            \
@@ -182,57 +880,2979 @@ extern "C" // C++ linkage
         return vector->data[index];                        \
     }                                                      \
                                                            \
-    static inline void vec_##NAME##_for_each(              \
+    static inline void vec_##NAME##_set_unchecked(         \
         vector_##NAME##_t *vector,                         \
-        void (*callback)(V value, size_t index)            \
+        const size_t index,                                \
+        V value                                            \
     )                                                      \
     {                                                      \
-        for (size_t i = 0; i < vector->length; i++)        \
-        {                                                  \
-            callback(vector->data[i], i);                  \
-        }                                                  \
+        vector->data[index] = value;                       \
     }                                                      \
                                                            \
-    static inline void vec_##NAME##_clear(                 \
-        vector_##NAME##_t *vector                          \
+    static inline V vec_##NAME##_get_unchecked(            \
+        vector_##NAME##_t *vector,                         \
+        const size_t index                                 \
     )                                                      \
     {                                                      \
-        vector->length = 0;                                \
+        return vector->data[index];                        \
     }                                                      \
                                                            \
-    static inline void vec_##NAME##_destroy(               \
+    static inline V *vec_##NAME##_at(                      \
         vector_##NAME##_t *vector,                         \
-        void (*free_fn)(V, size_t)                         \
+        const size_t index                                 \
     )                                                      \
     {                                                      \
-        if (free_fn != NULL)                               \
+        if (index >= vector->length)                       \
         {                                                  \
-            for (size_t i = 0; i < vector->length; i++)    \
-            {                                              \
-                free_fn(vector->data[i], i);               \
-            }                                              \
+            return NULL;                                   \
         }                                                  \
                                                            \
-        free(vector->data);                                \
-        vector->data = NULL;                               \
-                                                           \
-        vector->length = 0;                                \
-        vector->capacity = 0;                              \
+        return vector->data + index;                       \
     }                                                      \
                                                            \
-    static inline V vec_##NAME##_pop(                      \
+    static inline V *vec_##NAME##_data(                    \
         vector_##NAME##_t *vector                          \
     )                                                      \
     {                                                      \
-        if (vector->length == 0)                           \
-        {                                                  \
-            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
-            exit(1);                                       \
-        }                                                  \
+        return vector->data;                               \
+    }                                                      \
                                                            \
+    static inline void vec_##NAME##_insert_n(              \
+        vector_##NAME##_t *vector,                         \
+        const size_t index,                                \
+        const V *src,                                      \
+        const size_t n                                     \
+    )                                                      \
+    {                                                      \
+        if (index > vector->length)                        \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        if (n == 0)                                        \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        vec_##NAME##_detach(vector);                       \
+        vec_##NAME##_reserve(vector, vector->length + n);  \
+                                                           \
+        memmove(vector->data + index + n, vector->data + index, sizeof(V) * (vector->length - index)); \
+        memcpy(vector->data + index, src, sizeof(V) * n);  \
+        vector->length += n;                               \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_insert(                \
+        vector_##NAME##_t *vector,                         \
+        const size_t index,                                \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_insert_n(vector, index, (const V *)&value, 1); \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_splice(                \
+        vector_##NAME##_t *vector,                         \
+        const size_t index,                                \
+        const vector_##NAME##_t *src                       \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_insert_n(vector, index, (const V *)src->data, src->length); \
+    }                                                      \
+                                                           \
+    static inline V vec_##NAME##_swap_remove(              \
+        vector_##NAME##_t *vector,                         \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vec_##NAME##_detach(vector);                       \
+        V removed = vector->data[index];                   \
         vector->length--;                                  \
-        return vector->data[vector->length];               \
+        vector->data[index] = vector->data[vector->length]; \
+        return removed;                                    \
+    }                                                      \
+                                                           \
+    static inline size_t vec_##NAME##_remove_if(           \
+        vector_##NAME##_t *vector,                         \
+        int (*predicate)(V *value, size_t index, void *ctx), \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(vector);                       \
+        size_t write = 0;                                  \
+                                                           \
+        for (size_t read = 0; read < vector->length; read++) \
+        {                                                  \
+            if (!predicate(vector->data + read, read, ctx)) \
+            {                                              \
+                if (write != read)                         \
+                {                                          \
+                    vector->data[write] = vector->data[read]; \
+                }                                          \
+                                                           \
+                write++;                                   \
+            }                                              \
+        }                                                  \
+                                                           \
+        const size_t removed = vector->length - write;     \
+        vector->length = write;                            \
+        return removed;                                    \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_for_each(              \
+        vector_##NAME##_t *vector,                         \
+        void (*callback)(V value, size_t index)            \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->data[i], i);                  \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_sort(                  \
+        vector_##NAME##_t *vector,                         \
+        int (*cmp)(const void *a, const void *b)           \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(vector);                       \
+        qsort(vector->data, vector->length, sizeof(V), cmp); \
+    }                                                      \
+                                                           \
+    static inline size_t vec_##NAME##_lower_bound(         \
+        vector_##NAME##_t *vector,                         \
+        const V *key,                                      \
+        int (*cmp)(const void *a, const void *b)           \
+    )                                                      \
+    {                                                      \
+        size_t low = 0;                                    \
+        size_t count = vector->length;                     \
+                                                           \
+        while (count > 0)                                  \
+        {                                                  \
+            const size_t half = count / 2;                 \
+            const size_t mid = low + half;                 \
+                                                           \
+            if (cmp(vector->data + mid, key) < 0)          \
+            {                                              \
+                low = mid + 1;                             \
+                count -= half + 1;                         \
+            }                                              \
+            else                                           \
+            {                                              \
+                count = half;                              \
+            }                                              \
+        }                                                  \
+                                                           \
+        return low;                                        \
+    }                                                      \
+                                                           \
+    static inline int vec_##NAME##_binary_search(          \
+        vector_##NAME##_t *vector,                         \
+        const V *key,                                      \
+        int (*cmp)(const void *a, const void *b),          \
+        size_t *out_index                                  \
+    )                                                      \
+    {                                                      \
+        const size_t index = vec_##NAME##_lower_bound(vector, key, cmp); \
+                                                           \
+        if (index >= vector->length || cmp(vector->data + index, key) != 0) \
+        {                                                  \
+            return 0;                                      \
+        }                                                  \
+                                                           \
+        if (out_index != NULL)                             \
+        {                                                  \
+            *out_index = index;                            \
+        }                                                  \
+                                                           \
+        return 1;                                          \
+    }                                                      \
+                                                           \
+    static inline size_t vec_##NAME##_insert_sorted(       \
+        vector_##NAME##_t *vector,                         \
+        V value,                                           \
+        int (*cmp)(const void *a, const void *b)           \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(vector);                       \
+        vec_##NAME##_reserve(vector, vector->length + 1);  \
+        const size_t index = vec_##NAME##_lower_bound(vector, (const V *)&value, cmp); \
+                                                           \
+        memmove(vector->data + index + 1, vector->data + index, sizeof(V) * (vector->length - index)); \
+        vector->data[index] = value;                       \
+        vector->length++;                                  \
+        return index;                                      \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_for_each_ctx(          \
+        vector_##NAME##_t *vector,                         \
+        int (*callback)(V *value, size_t index, void *ctx), \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            if (callback(vector->data + i, i, ctx))        \
+            {                                              \
+                return;                                    \
+            }                                              \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline int vec_##NAME##_find(                   \
+        vector_##NAME##_t *vector,                         \
+        int (*predicate)(V *value, size_t index, void *ctx), \
+        void *ctx,                                         \
+        size_t *out_index                                  \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            if (predicate(vector->data + i, i, ctx))       \
+            {                                              \
+                if (out_index != NULL)                     \
+                {                                          \
+                    *out_index = i;                        \
+                }                                          \
+                                                           \
+                return 1;                                  \
+            }                                              \
+        }                                                  \
+                                                           \
+        return 0;                                          \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_map_to(                \
+        vector_##NAME##_t *src,                            \
+        vector_##NAME##_t *dst,                            \
+        V (*fn)(V value, void *ctx),                       \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(dst);                          \
+        vec_##NAME##_reserve(dst, dst->length + src->length); \
+                                                           \
+        for (size_t i = 0; i < src->length; i++)           \
+        {                                                  \
+            dst->data[dst->length++] = fn(src->data[i], ctx); \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_filter_to(             \
+        vector_##NAME##_t *src,                            \
+        vector_##NAME##_t *dst,                            \
+        int (*predicate)(V *value, size_t index, void *ctx), \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(dst);                          \
+        vec_##NAME##_reserve(dst, dst->length + src->length); \
+                                                           \
+        for (size_t i = 0; i < src->length; i++)           \
+        {                                                  \
+            if (predicate(src->data + i, i, ctx))          \
+            {                                              \
+                dst->data[dst->length++] = src->data[i];   \
+            }                                              \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline V vec_##NAME##_reduce(                   \
+        vector_##NAME##_t *vector,                         \
+        V (*fn)(V accumulator, V value, void *ctx),        \
+        V init,                                            \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        V accumulator = init;                              \
+                                                           \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            accumulator = fn(accumulator, vector->data[i], ctx); \
+        }                                                  \
+                                                           \
+        return accumulator;                                \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_pipeline(              \
+        vector_##NAME##_t *src,                            \
+        vector_##NAME##_t *dst,                            \
+        const vec_##NAME##_stage_t *stages,                \
+        const size_t n_stages                              \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(dst);                          \
+        vec_##NAME##_reserve(dst, dst->length + src->length); \
+                                                           \
+        for (size_t i = 0; i < src->length; i++)           \
+        {                                                  \
+            V value = src->data[i];                        \
+            int keep = 1;                                  \
+                                                           \
+            for (size_t s = 0; s < n_stages; s++)          \
+            {                                              \
+                if (stages[s].map_fn != NULL)              \
+                {                                          \
+                    value = stages[s].map_fn(value, stages[s].ctx); \
+                }                                          \
+                else if (stages[s].filter_fn != NULL &&    \
+                         !stages[s].filter_fn(&value, i, stages[s].ctx)) \
+                {                                          \
+                    keep = 0;                              \
+                    break;                                 \
+                }                                          \
+            }                                              \
+                                                           \
+            if (keep)                                      \
+            {                                              \
+                dst->data[dst->length++] = value;          \
+            }                                              \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_gather(                \
+        vector_##NAME##_t *vector,                         \
+        const size_t *indices,                             \
+        const size_t n,                                    \
+        V *out                                             \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < n; i++)                     \
+        {                                                  \
+            if (i + FLUENT_LIBC_VECTOR_GATHER_AHEAD < n)   \
+            {                                              \
+                FLUENT_VEC_PREFETCH(vector->data + indices[i + FLUENT_LIBC_VECTOR_GATHER_AHEAD]); \
+            }                                              \
+                                                           \
+            if (indices[i] >= vector->length)              \
+            {                                              \
+                fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+                exit(1);                                   \
+            }                                              \
+                                                           \
+            out[i] = vector->data[indices[i]];             \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_gather_unchecked(      \
+        vector_##NAME##_t *vector,                         \
+        const size_t *indices,                             \
+        const size_t n,                                    \
+        V *out                                             \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < n; i++)                     \
+        {                                                  \
+            if (i + FLUENT_LIBC_VECTOR_GATHER_AHEAD < n)   \
+            {                                              \
+                FLUENT_VEC_PREFETCH(vector->data + indices[i + FLUENT_LIBC_VECTOR_GATHER_AHEAD]); \
+            }                                              \
+                                                           \
+            out[i] = vector->data[indices[i]];             \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_gather_for_each(       \
+        vector_##NAME##_t *vector,                         \
+        const size_t *indices,                             \
+        const size_t n,                                    \
+        int (*callback)(V *value, size_t index, void *ctx), \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < n; i++)                     \
+        {                                                  \
+            if (i + FLUENT_LIBC_VECTOR_GATHER_AHEAD < n)   \
+            {                                              \
+                FLUENT_VEC_PREFETCH(vector->data + indices[i + FLUENT_LIBC_VECTOR_GATHER_AHEAD]); \
+            }                                              \
+                                                           \
+            if (indices[i] >= vector->length)              \
+            {                                              \
+                fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+                exit(1);                                   \
+            }                                              \
+                                                           \
+            if (callback(vector->data + indices[i], i, ctx)) \
+            {                                              \
+                return;                                    \
+            }                                              \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline vec_##NAME##_slice_t vec_##NAME##_slice( \
+        vector_##NAME##_t *vector,                         \
+        const size_t start,                                \
+        const size_t end                                   \
+    )                                                      \
+    {                                                      \
+        if (start > end || end > vector->length)           \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vec_##NAME##_slice_t slice;                        \
+        slice.data = vector->data + start;                 \
+        slice.length = end - start;                        \
+        return slice;                                      \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_slice_for_each(        \
+        const vec_##NAME##_slice_t slice,                  \
+        int (*callback)(V *value, size_t index, void *ctx), \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < slice.length; i++)          \
+        {                                                  \
+            if (callback(slice.data + i, i, ctx))          \
+            {                                              \
+                return;                                    \
+            }                                              \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline int vec_##NAME##_slice_find(             \
+        const vec_##NAME##_slice_t slice,                  \
+        int (*predicate)(V *value, size_t index, void *ctx), \
+        void *ctx,                                         \
+        size_t *out_index                                  \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < slice.length; i++)          \
+        {                                                  \
+            if (predicate(slice.data + i, i, ctx))         \
+            {                                              \
+                if (out_index != NULL)                     \
+                {                                          \
+                    *out_index = i;                        \
+                }                                          \
+                                                           \
+                return 1;                                  \
+            }                                              \
+        }                                                  \
+                                                           \
+        return 0;                                          \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_slice_sort(            \
+        const vec_##NAME##_slice_t slice,                  \
+        int (*cmp)(const void *a, const void *b)           \
+    )                                                      \
+    {                                                      \
+        qsort(slice.data, slice.length, sizeof(V), cmp);   \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_push_slice(            \
+        vector_##NAME##_t *vector,                         \
+        const vec_##NAME##_slice_t slice                   \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_push_n(vector, (const V *)slice.data, slice.length); \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_clear(                 \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_stats(                 \
+        vector_##NAME##_t *vector,                         \
+        vec_stats_t *out                                   \
+    )                                                      \
+    {                                                      \
+        FLUENT_VEC_STATS_READ(vector, out);                \
+        out->length = vector->length;                      \
+        out->capacity = vector->capacity;                  \
+        out->wasted_capacity = vector->capacity - vector->length; \
     }                                                      \
+                                                           \
+    static inline V *vec_##NAME##_take(                    \
+        vector_##NAME##_t *vector,                         \
+        size_t *out_len                                    \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(vector);                       \
+                                                           \
+        V *buffer = vector->data;                          \
+                                                           \
+        if (out_len != NULL)                               \
+        {                                                  \
+            *out_len = vector->length;                     \
+        }                                                  \
+                                                           \
+        vector->data = NULL;                               \
+        vector->length = 0;                                \
+        vector->capacity = 0;                              \
+        return buffer;                                     \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_move(                  \
+        vector_##NAME##_t *dst,                            \
+        vector_##NAME##_t *src                             \
+    )                                                      \
+    {                                                      \
+        *dst = *src;                                       \
+        src->data = NULL;                                  \
+        src->cow_refs = NULL;                              \
+        src->length = 0;                                   \
+        src->capacity = 0;                                 \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_adopt(                 \
+        vector_##NAME##_t *vector,                         \
+        V *buffer,                                         \
+        const size_t length,                               \
+        const size_t capacity,                             \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        vector->data = buffer;                             \
+        vector->length = length;                           \
+        vector->capacity = capacity;                       \
+        vector->growth_factor = growth_factor;             \
+        vector->allocator = vector_libc_allocator();       \
+        vector->cow_refs = NULL;                           \
+        vector->growth_policy = vector_default_growth_policy(); \
+        FLUENT_VEC_STATS_ON_INIT(vector, capacity);        \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_shrink_to_fit(         \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        const size_t target = vector->length > 0 ? vector->length : 1; \
+                                                           \
+        if (target < vector->capacity)                     \
+        {                                                  \
+            vec_##NAME##_resize(vector, target);           \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_clear_release(         \
+        vector_##NAME##_t *vector,                         \
+        const size_t new_capacity                          \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+        const size_t target = new_capacity > 0 ? new_capacity : 1; \
+                                                           \
+        if (target < vector->capacity)                     \
+        {                                                  \
+            vec_##NAME##_resize(vector, target);           \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_destroy(               \
+        vector_##NAME##_t *vector,                         \
+        void (*free_fn)(V, size_t)                         \
+    )                                                      \
+    {                                                      \
+        if (vector->cow_refs != NULL)                      \
+        {                                                  \
+            (*vector->cow_refs)--;                         \
+                                                           \
+            if (*vector->cow_refs > 0)                     \
+            {                                              \
+                vector->data = NULL;                       \
+                vector->cow_refs = NULL;                   \
+                vector->length = 0;                        \
+                vector->capacity = 0;                      \
+                return;                                    \
+            }                                              \
+                                                           \
+            vector->allocator.free(vector->cow_refs, vector->allocator.ctx); \
+            vector->cow_refs = NULL;                       \
+        }                                                  \
+                                                           \
+        if (free_fn != NULL)                               \
+        {                                                  \
+            for (size_t i = 0; i < vector->length; i++)    \
+            {                                              \
+                free_fn(vector->data[i], i);               \
+            }                                              \
+        }                                                  \
+                                                           \
+        vector->allocator.free(vector->data, vector->allocator.ctx); \
+        vector->data = NULL;                               \
+                                                           \
+        vector->length = 0;                                \
+        vector->capacity = 0;                              \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_destroy_batch(         \
+        vector_##NAME##_t *vector,                         \
+        void (*free_batch)(V *items, size_t n, void *ctx), \
+        void *ctx                                          \
+    )                                                      \
+    {                                                      \
+        if (vector->cow_refs != NULL)                      \
+        {                                                  \
+            (*vector->cow_refs)--;                         \
+                                                           \
+            if (*vector->cow_refs > 0)                     \
+            {                                              \
+                vector->data = NULL;                       \
+                vector->cow_refs = NULL;                   \
+                vector->length = 0;                        \
+                vector->capacity = 0;                      \
+                return;                                    \
+            }                                              \
+                                                           \
+            vector->allocator.free(vector->cow_refs, vector->allocator.ctx); \
+            vector->cow_refs = NULL;                       \
+        }                                                  \
+                                                           \
+        if (free_batch != NULL && vector->length > 0)      \
+        {                                                  \
+            free_batch(vector->data, vector->length, ctx); \
+        }                                                  \
+                                                           \
+        vector->allocator.free(vector->data, vector->allocator.ctx); \
+        vector->data = NULL;                               \
+                                                           \
+        vector->length = 0;                                \
+        vector->capacity = 0;                              \
+    }                                                      \
+                                                           \
+    static inline V vec_##NAME##_pop(                      \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        if (vector->length == 0)                           \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length--;                                  \
+        return vector->data[vector->length];               \
+    }                                                      \
+
+#define DEFINE_VECTOR_ALIGNED(V, NAME, ALIGN)              \
+    DEFINE_VECTOR(V, NAME)                                 \
+                                                           \
+    static inline void vec_##NAME##_init_aligned(          \
+        vector_##NAME##_t *vector,                         \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_init_with_allocator(vector, initial_capacity, growth_factor, vector_aligned_allocator(ALIGN)); \
+    }                                                      \
+
+// == TRIVIAL VS LARGE ELEMENT SPECIALIZATION ==
+// Pick the generator per element size. DEFINE_VECTOR_POD is the
+// value-passing form (the base generator already is one — small
+// trivially-copyable elements travel in registers). DEFINE_VECTOR_BIG
+// adds by-reference entry points on top of the same vector_<NAME>_t so
+// multi-hundred-byte structs never cross the call ABI by value:
+// push_ref/set_ref/insert_ref memcpy from the caller's storage,
+// emplace grows and returns a pointer to the new slot so callers
+// build the element in place (zero copies), and pop_into copies the
+// tail element out through a pointer. The value-passing functions
+// remain available, so both forms interoperate.
+#define DEFINE_VECTOR_POD(V, NAME)                         \
+    DEFINE_VECTOR(V, NAME)                                 \
+
+#define DEFINE_VECTOR_BIG(V, NAME)                         \
+    DEFINE_VECTOR(V, NAME)                                 \
+                                                           \
+    static inline V *vec_##NAME##_emplace(                 \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_detach(vector);                       \
+        vec_##NAME##_reserve(vector, vector->length + 1);  \
+        FLUENT_VEC_STATS_ON_PUSH(vector, 1);               \
+        return vector->data + vector->length++;            \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_push_ref(              \
+        vector_##NAME##_t *vector,                         \
+        const V *value                                     \
+    )                                                      \
+    {                                                      \
+        memcpy(vec_##NAME##_emplace(vector), value, sizeof(V)); \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_set_ref(               \
+        vector_##NAME##_t *vector,                         \
+        const size_t index,                                \
+        const V *value                                     \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vec_##NAME##_detach(vector);                       \
+        memcpy(vector->data + index, value, sizeof(V));    \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_insert_ref(            \
+        vector_##NAME##_t *vector,                         \
+        const size_t index,                                \
+        const V *value                                     \
+    )                                                      \
+    {                                                      \
+        if (index > vector->length)                        \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vec_##NAME##_detach(vector);                       \
+        vec_##NAME##_reserve(vector, vector->length + 1);  \
+        memmove(vector->data + index + 1, vector->data + index, sizeof(V) * (vector->length - index)); \
+        memcpy(vector->data + index, value, sizeof(V));    \
+        vector->length++;                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_pop_into(              \
+        vector_##NAME##_t *vector,                         \
+        V *out                                             \
+    )                                                      \
+    {                                                      \
+        if (vector->length == 0)                           \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length--;                                  \
+        memcpy(out, vector->data + vector->length, sizeof(V)); \
+    }                                                      \
+
+#define DEFINE_SMALL_VECTOR(V, NAME, N)                    \
+    typedef struct                                         \
+    {                                                      \
+        size_t length;                                     \
+        size_t capacity;                                   \
+        double growth_factor;                              \
+        V *data;                                           \
+        V inline_data[N];                                  \
+    } small_vector_##NAME##_t;                             \
+                                                           \
+    static inline void vec_##NAME##_init(                  \
+        small_vector_##NAME##_t *vector,                   \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+        vector->capacity = N;                              \
+        vector->growth_factor = growth_factor;             \
+        vector->data = vector->inline_data;                \
+    }                                                      \
+                                                           \
+    static inline int vec_##NAME##_is_inline(              \
+        small_vector_##NAME##_t *vector                    \
+    )                                                      \
+    {                                                      \
+        return vector->data == vector->inline_data;        \
+    }                                                      \
+                                                           \
+    static inline size_t vec_##NAME##_capacity(            \
+        small_vector_##NAME##_t *vector                    \
+    )                                                      \
+    {                                                      \
+        return vector->capacity;                           \
+    }                                                      \
+                                                           \
+    static inline size_t vec_##NAME##_len(                 \
+        small_vector_##NAME##_t *vector                    \
+    )                                                      \
+    {                                                      \
+        return vector->length;                             \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_resize(                \
+        small_vector_##NAME##_t *vector,                   \
+        const size_t new_capacity                          \
+    )                                                      \
+    {                                                      \
+        if (new_capacity <= N && vec_##NAME##_is_inline(vector)) \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        if (vec_##NAME##_is_inline(vector))                \
+        {                                                  \
+            V *new_data = (V *)malloc(sizeof(V) * new_capacity); \
+                                                           \
+            if (new_data == NULL)                          \
+            {                                              \
+                fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+                exit(1);                                   \
+            }                                              \
+                                                           \
+            memcpy(new_data, vector->inline_data, sizeof(V) * vector->length); \
+            vector->data = new_data;                       \
+            vector->capacity = new_capacity;               \
+            return;                                        \
+        }                                                  \
+                                                           \
+        V *new_data = (V *)realloc(vector->data, sizeof(V) * new_capacity); \
+                                                           \
+        if (new_data == NULL)                              \
+        {                                                  \
+            free(vector->data);                            \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->data = new_data;                           \
+        vector->capacity = new_capacity;                   \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_reserve(               \
+        small_vector_##NAME##_t *vector,                   \
+        const size_t total_capacity                        \
+    )                                                      \
+    {                                                      \
+        if (total_capacity <= vector->capacity)            \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        size_t new_capacity = vector->capacity;            \
+                                                           \
+        while (new_capacity < total_capacity)              \
+        {                                                  \
+            const size_t grown = (size_t)(new_capacity * vector->growth_factor); \
+            new_capacity = grown > new_capacity ? grown : total_capacity; \
+        }                                                  \
+                                                           \
+        vec_##NAME##_resize(vector, new_capacity);         \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_ensure(                \
+        small_vector_##NAME##_t *vector,                   \
+        const size_t n                                     \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_reserve(vector, vector->length + n);  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_push(                  \
+        small_vector_##NAME##_t *vector,                   \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_ensure(vector, 1);                    \
+        vector->data[vector->length] = value;              \
+        vector->length++;                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_push_n(                \
+        small_vector_##NAME##_t *vector,                   \
+        const V *src,                                      \
+        const size_t n                                     \
+    )                                                      \
+    {                                                      \
+        if (n == 0)                                        \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        vec_##NAME##_reserve(vector, vector->length + n);  \
+        memcpy(vector->data + vector->length, src, sizeof(V) * n); \
+        vector->length += n;                               \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_set(                   \
+        small_vector_##NAME##_t *vector,                   \
+        const size_t index,                                \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->data[index] = value;                       \
+    }                                                      \
+                                                           \
+    static inline V vec_##NAME##_get(                      \
+        small_vector_##NAME##_t *vector,                   \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->data[index];                        \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_for_each(              \
+        small_vector_##NAME##_t *vector,                   \
+        void (*callback)(V value, size_t index)            \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->data[i], i);                  \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_clear(                 \
+        small_vector_##NAME##_t *vector                    \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+    }                                                      \
+                                                           \
+    static inline V vec_##NAME##_pop(                      \
+        small_vector_##NAME##_t *vector                    \
+    )                                                      \
+    {                                                      \
+        if (vector->length == 0)                           \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length--;                                  \
+        return vector->data[vector->length];               \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_destroy(               \
+        small_vector_##NAME##_t *vector,                   \
+        void (*free_fn)(V, size_t)                         \
+    )                                                      \
+    {                                                      \
+        if (free_fn != NULL)                               \
+        {                                                  \
+            for (size_t i = 0; i < vector->length; i++)    \
+            {                                              \
+                free_fn(vector->data[i], i);               \
+            }                                              \
+        }                                                  \
+                                                           \
+        if (!vec_##NAME##_is_inline(vector))               \
+        {                                                  \
+            free(vector->data);                            \
+        }                                                  \
+                                                           \
+        vector->data = vector->inline_data;                \
+        vector->length = 0;                                \
+        vector->capacity = N;                              \
+    }                                                      \
+
+// == STRUCT-OF-ARRAYS VECTORS ==
+// Column-wise storage: each field lives in its own parallel array
+// with one shared length/capacity/growth_factor, so a scan over one
+// field streams only that field's bytes (and lines up with SIMD
+// kernels written for standalone columns). C macros cannot expand a
+// variable field list, so the generator comes in fixed arities —
+// DEFINE_SOA_VECTOR_2(NAME, T1, F1, T2, F2) and a 3-column form.
+// Per-field accessors are soa_<NAME>_<FIELD>_data/get/for_each;
+// push/resize/destroy keep every column in lockstep.
+#define DEFINE_SOA_VECTOR_2(NAME, T1, F1, T2, F2)          \
+    typedef struct                                         \
+    {                                                      \
+        size_t length;                                     \
+        size_t capacity;                                   \
+        double growth_factor;                              \
+        T1 *F1;                                            \
+        T2 *F2;                                            \
+    } soa_vector_##NAME##_t;                               \
+                                                           \
+    static inline void soa_##NAME##_init(                  \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        if (initial_capacity == 0)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Initial capacity cannot be 0 (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length = 0;                                \
+        vector->capacity = initial_capacity;               \
+        vector->growth_factor = growth_factor;             \
+        vector->F1 = (T1 *)malloc(sizeof(T1) * initial_capacity); \
+        vector->F2 = (T2 *)malloc(sizeof(T2) * initial_capacity); \
+                                                           \
+        if (vector->F1 == NULL || vector->F2 == NULL)      \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline size_t soa_##NAME##_len(                 \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->length;                             \
+    }                                                      \
+                                                           \
+    static inline size_t soa_##NAME##_capacity(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->capacity;                           \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_reserve(               \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t needed                                \
+    )                                                      \
+    {                                                      \
+        if (needed <= vector->capacity)                    \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        size_t new_capacity = (size_t)(vector->capacity * vector->growth_factor); \
+                                                           \
+        if (new_capacity < needed)                         \
+        {                                                  \
+            new_capacity = needed;                         \
+        }                                                  \
+                                                           \
+        T1 *new_##F1 = (T1 *)realloc(vector->F1, sizeof(T1) * new_capacity); \
+        T2 *new_##F2 = (T2 *)realloc(vector->F2, sizeof(T2) * new_capacity); \
+                                                           \
+        if (new_##F1 == NULL || new_##F2 == NULL)          \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->F1 = new_##F1;                             \
+        vector->F2 = new_##F2;                             \
+        vector->capacity = new_capacity;                   \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_push(                  \
+        soa_vector_##NAME##_t *vector,                     \
+        T1 F1##_value,                                     \
+        T2 F2##_value                                      \
+    )                                                      \
+    {                                                      \
+        soa_##NAME##_reserve(vector, vector->length + 1);  \
+        vector->F1[vector->length] = F1##_value;           \
+        vector->F2[vector->length] = F2##_value;           \
+        vector->length++;                                  \
+    }                                                      \
+                                                           \
+    static inline T1 *soa_##NAME##_##F1##_data(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->F1;                                 \
+    }                                                      \
+                                                           \
+    static inline T2 *soa_##NAME##_##F2##_data(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->F2;                                 \
+    }                                                      \
+                                                           \
+    static inline T1 soa_##NAME##_##F1##_get(              \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->F1[index];                          \
+    }                                                      \
+                                                           \
+    static inline T2 soa_##NAME##_##F2##_get(              \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->F2[index];                          \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_##F1##_for_each(       \
+        soa_vector_##NAME##_t *vector,                     \
+        void (*callback)(T1 value, size_t index)           \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->F1[i], i);                    \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_##F2##_for_each(       \
+        soa_vector_##NAME##_t *vector,                     \
+        void (*callback)(T2 value, size_t index)           \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->F2[i], i);                    \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_clear(                 \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_destroy(               \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        free(vector->F1);                                  \
+        free(vector->F2);                                  \
+        vector->F1 = NULL;                                 \
+        vector->F2 = NULL;                                 \
+        vector->length = 0;                                \
+        vector->capacity = 0;                              \
+    }                                                      \
+
+#define DEFINE_SOA_VECTOR_3(NAME, T1, F1, T2, F2, T3, F3)  \
+    typedef struct                                         \
+    {                                                      \
+        size_t length;                                     \
+        size_t capacity;                                   \
+        double growth_factor;                              \
+        T1 *F1;                                            \
+        T2 *F2;                                            \
+        T3 *F3;                                            \
+    } soa_vector_##NAME##_t;                               \
+                                                           \
+    static inline void soa_##NAME##_init(                  \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        if (initial_capacity == 0)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Initial capacity cannot be 0 (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length = 0;                                \
+        vector->capacity = initial_capacity;               \
+        vector->growth_factor = growth_factor;             \
+        vector->F1 = (T1 *)malloc(sizeof(T1) * initial_capacity); \
+        vector->F2 = (T2 *)malloc(sizeof(T2) * initial_capacity); \
+        vector->F3 = (T3 *)malloc(sizeof(T3) * initial_capacity); \
+                                                           \
+        if (vector->F1 == NULL || vector->F2 == NULL || vector->F3 == NULL) \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline size_t soa_##NAME##_len(                 \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->length;                             \
+    }                                                      \
+                                                           \
+    static inline size_t soa_##NAME##_capacity(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->capacity;                           \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_reserve(               \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t needed                                \
+    )                                                      \
+    {                                                      \
+        if (needed <= vector->capacity)                    \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        size_t new_capacity = (size_t)(vector->capacity * vector->growth_factor); \
+                                                           \
+        if (new_capacity < needed)                         \
+        {                                                  \
+            new_capacity = needed;                         \
+        }                                                  \
+                                                           \
+        T1 *new_##F1 = (T1 *)realloc(vector->F1, sizeof(T1) * new_capacity); \
+        T2 *new_##F2 = (T2 *)realloc(vector->F2, sizeof(T2) * new_capacity); \
+        T3 *new_##F3 = (T3 *)realloc(vector->F3, sizeof(T3) * new_capacity); \
+                                                           \
+        if (new_##F1 == NULL || new_##F2 == NULL || new_##F3 == NULL) \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->F1 = new_##F1;                             \
+        vector->F2 = new_##F2;                             \
+        vector->F3 = new_##F3;                             \
+        vector->capacity = new_capacity;                   \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_push(                  \
+        soa_vector_##NAME##_t *vector,                     \
+        T1 F1##_value,                                     \
+        T2 F2##_value,                                     \
+        T3 F3##_value                                      \
+    )                                                      \
+    {                                                      \
+        soa_##NAME##_reserve(vector, vector->length + 1);  \
+        vector->F1[vector->length] = F1##_value;           \
+        vector->F2[vector->length] = F2##_value;           \
+        vector->F3[vector->length] = F3##_value;           \
+        vector->length++;                                  \
+    }                                                      \
+                                                           \
+    static inline T1 *soa_##NAME##_##F1##_data(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->F1;                                 \
+    }                                                      \
+                                                           \
+    static inline T2 *soa_##NAME##_##F2##_data(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->F2;                                 \
+    }                                                      \
+                                                           \
+    static inline T3 *soa_##NAME##_##F3##_data(            \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        return vector->F3;                                 \
+    }                                                      \
+                                                           \
+    static inline T1 soa_##NAME##_##F1##_get(              \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->F1[index];                          \
+    }                                                      \
+                                                           \
+    static inline T2 soa_##NAME##_##F2##_get(              \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->F2[index];                          \
+    }                                                      \
+                                                           \
+    static inline T3 soa_##NAME##_##F3##_get(              \
+        soa_vector_##NAME##_t *vector,                     \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->F3[index];                          \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_##F1##_for_each(       \
+        soa_vector_##NAME##_t *vector,                     \
+        void (*callback)(T1 value, size_t index)           \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->F1[i], i);                    \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_##F2##_for_each(       \
+        soa_vector_##NAME##_t *vector,                     \
+        void (*callback)(T2 value, size_t index)           \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->F2[i], i);                    \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_##F3##_for_each(       \
+        soa_vector_##NAME##_t *vector,                     \
+        void (*callback)(T3 value, size_t index)           \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < vector->length; i++)        \
+        {                                                  \
+            callback(vector->F3[i], i);                    \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_clear(                 \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+    }                                                      \
+                                                           \
+    static inline void soa_##NAME##_destroy(               \
+        soa_vector_##NAME##_t *vector                      \
+    )                                                      \
+    {                                                      \
+        free(vector->F1);                                  \
+        free(vector->F2);                                  \
+        free(vector->F3);                                  \
+        vector->F1 = NULL;                                 \
+        vector->F2 = NULL;                                 \
+        vector->F3 = NULL;                                 \
+        vector->length = 0;                                \
+        vector->capacity = 0;                              \
+    }                                                      \
+
+// == MMAP-BACKED VECTORS (POSIX only) ==
+// Persistent vectors whose buffer is a memory-mapped file: a 64-byte
+// header (magic, element size, length, capacity) followed by the raw
+// element payload. Startup is page-fault driven instead of a bulk read,
+// growth is ftruncate + remap, and snapshotting a column is a file
+// copy. vec_<NAME>_msync persists the current length — call it before
+// destroy (which unmaps) to make the length durable.
+// Compiled out when the platform or feature-test macros don't expose
+// POSIX (e.g. strict -std=c11 without _POSIX_C_SOURCE).
+#ifdef FLUENT_LIBC_VECTOR_HAS_POSIX
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef FLUENT_LIBC_VECTOR_MMAP_DEFINED
+#   define FLUENT_LIBC_VECTOR_MMAP_DEFINED 1
+#   define FLUENT_LIBC_VECTOR_MMAP_MAGIC 0x31304345564C46ULL /* "FLVEC01" */
+#   define FLUENT_LIBC_VECTOR_MMAP_HEADER 64
+
+    typedef struct
+    {
+        uint64_t magic;
+        uint64_t element_size;
+        uint64_t length;
+        uint64_t capacity;
+    } vector_mmap_header_t;
+
+    typedef struct
+    {
+        int fd;
+        void *base;
+        size_t map_size;
+    } vector_mmap_ctx_t;
+
+    static inline void *vector_mmap_alloc(const size_t size, void *ctx)
+    {
+        vector_mmap_ctx_t *state = (vector_mmap_ctx_t *)ctx;
+        const size_t map_size = size + FLUENT_LIBC_VECTOR_MMAP_HEADER;
+
+        if (ftruncate(state->fd, (off_t)map_size) != 0)
+        {
+            return NULL;
+        }
+
+        void *base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, state->fd, 0);
+
+        if (base == MAP_FAILED)
+        {
+            return NULL;
+        }
+
+        state->base = base;
+        state->map_size = map_size;
+        return (unsigned char *)base + FLUENT_LIBC_VECTOR_MMAP_HEADER;
+    }
+
+    static inline void *vector_mmap_realloc(void *ptr, const size_t size, void *ctx)
+    {
+        (void)ptr;
+        vector_mmap_ctx_t *state = (vector_mmap_ctx_t *)ctx;
+        const size_t map_size = size + FLUENT_LIBC_VECTOR_MMAP_HEADER;
+
+        if (ftruncate(state->fd, (off_t)map_size) != 0)
+        {
+            return NULL;
+        }
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+        void *base = mremap(state->base, state->map_size, map_size, MREMAP_MAYMOVE);
+#else
+        munmap(state->base, state->map_size);
+        void *base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, state->fd, 0);
+#endif
+
+        if (base == MAP_FAILED)
+        {
+            return NULL;
+        }
+
+        state->base = base;
+        state->map_size = map_size;
+
+        vector_mmap_header_t *header = (vector_mmap_header_t *)base;
+        header->capacity = size / header->element_size;
+        return (unsigned char *)base + FLUENT_LIBC_VECTOR_MMAP_HEADER;
+    }
+
+    static inline void vector_mmap_free(void *ptr, void *ctx)
+    {
+        (void)ptr;
+        vector_mmap_ctx_t *state = (vector_mmap_ctx_t *)ctx;
+
+        msync(state->base, state->map_size, MS_SYNC);
+        munmap(state->base, state->map_size);
+        close(state->fd);
+        free(state);
+    }
+#endif
+
+#define DEFINE_VECTOR_MMAP(V, NAME)                        \
+    DEFINE_VECTOR(V, NAME)                                 \
+                                                           \
+    static inline void vec_##NAME##_init_mmap(             \
+        vector_##NAME##_t *vector,                         \
+        const char *path,                                  \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        if (initial_capacity == 0)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Initial capacity cannot be 0 (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector_mmap_ctx_t *state = (vector_mmap_ctx_t *)malloc(sizeof(vector_mmap_ctx_t)); \
+                                                           \
+        if (state == NULL)                                 \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        state->fd = open(path, O_RDWR | O_CREAT, 0644);    \
+                                                           \
+        if (state->fd < 0)                                 \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot open mmap file (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        struct stat st;                                    \
+                                                           \
+        if (fstat(state->fd, &st) != 0)                    \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot stat mmap file (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        const int fresh = st.st_size < (off_t)FLUENT_LIBC_VECTOR_MMAP_HEADER; \
+        const size_t payload = fresh                       \
+            ? sizeof(V) * initial_capacity                 \
+            : (size_t)st.st_size - FLUENT_LIBC_VECTOR_MMAP_HEADER; \
+                                                           \
+        vector->growth_factor = growth_factor;             \
+        vector->cow_refs = NULL;                           \
+        vector->growth_policy = vector_default_growth_policy(); \
+        vector->allocator.alloc = vector_mmap_alloc;       \
+        vector->allocator.realloc = vector_mmap_realloc;   \
+        vector->allocator.free = vector_mmap_free;         \
+        vector->allocator.ctx = state;                     \
+        vector->data = (V *)vector_mmap_alloc(payload, state); \
+                                                           \
+        if (vector->data == NULL)                          \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot map file (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector_mmap_header_t *header = (vector_mmap_header_t *)state->base; \
+                                                           \
+        if (fresh)                                         \
+        {                                                  \
+            header->magic = FLUENT_LIBC_VECTOR_MMAP_MAGIC; \
+            header->element_size = sizeof(V);              \
+            header->length = 0;                            \
+            header->capacity = initial_capacity;           \
+        }                                                  \
+        else if (header->magic != FLUENT_LIBC_VECTOR_MMAP_MAGIC || header->element_size != sizeof(V)) \
+        {                                                  \
+            fprintf(stderr, "Error: Invalid mmap vector file (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length = (size_t)header->length;           \
+        vector->capacity = (size_t)header->capacity;       \
+        FLUENT_VEC_STATS_ON_INIT(vector, vector->capacity); \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_msync(                 \
+        vector_##NAME##_t *vector                          \
+    )                                                      \
+    {                                                      \
+        vector_mmap_ctx_t *state = (vector_mmap_ctx_t *)vector->allocator.ctx; \
+        vector_mmap_header_t *header = (vector_mmap_header_t *)state->base; \
+                                                           \
+        header->length = vector->length;                   \
+        header->capacity = vector->capacity;               \
+        msync(state->base, state->map_size, MS_SYNC);      \
+    }                                                      \
+
+// == SERIALIZATION (POSIX only) ==
+// Zero-copy checkpointing with a framed format: a small header (magic,
+// element size, length) followed by the raw buffer. vec_<NAME>_write
+// emits header and payload in one writev; vec_<NAME>_read validates
+// the frame, reserves once and reads straight into data — no
+// intermediate buffers on either side.
+#ifndef FLUENT_LIBC_VECTOR_IO_DEFINED
+#   define FLUENT_LIBC_VECTOR_IO_DEFINED 1
+#   define FLUENT_LIBC_VECTOR_IO_MAGIC 0x32304345564C46ULL /* "FLVEC02" */
+
+#include <sys/uio.h>
+
+    typedef struct
+    {
+        uint64_t magic;
+        uint64_t element_size;
+        uint64_t length;
+    } vector_io_header_t;
+
+    static inline vector_error_t vector_io_write_all(const int fd, const void *buf, size_t n)
+    {
+        const unsigned char *cursor = (const unsigned char *)buf;
+
+        while (n > 0)
+        {
+            const ssize_t written = write(fd, cursor, n);
+
+            if (written <= 0)
+            {
+                return VECTOR_ERR_IO;
+            }
+
+            cursor += written;
+            n -= (size_t)written;
+        }
+
+        return VECTOR_OK;
+    }
+
+    static inline vector_error_t vector_io_read_all(const int fd, void *buf, size_t n)
+    {
+        unsigned char *cursor = (unsigned char *)buf;
+
+        while (n > 0)
+        {
+            const ssize_t got = read(fd, cursor, n);
+
+            if (got <= 0)
+            {
+                return VECTOR_ERR_IO;
+            }
+
+            cursor += got;
+            n -= (size_t)got;
+        }
+
+        return VECTOR_OK;
+    }
+#endif
+
+#define DEFINE_VECTOR_IO(V, NAME)                          \
+    DEFINE_VECTOR(V, NAME)                                 \
+                                                           \
+    static inline vector_error_t vec_##NAME##_write(       \
+        vector_##NAME##_t *vector,                         \
+        const int fd                                       \
+    )                                                      \
+    {                                                      \
+        vector_io_header_t header;                         \
+        header.magic = FLUENT_LIBC_VECTOR_IO_MAGIC;        \
+        header.element_size = sizeof(V);                   \
+        header.length = vector->length;                    \
+                                                           \
+        struct iovec iov[2];                               \
+        iov[0].iov_base = &header;                         \
+        iov[0].iov_len = sizeof(header);                   \
+        iov[1].iov_base = vector->data;                    \
+        iov[1].iov_len = sizeof(V) * vector->length;       \
+                                                           \
+        const size_t total = iov[0].iov_len + iov[1].iov_len; \
+        const ssize_t written = writev(fd, iov, 2);        \
+                                                           \
+        if (written < 0)                                   \
+        {                                                  \
+            return VECTOR_ERR_IO;                          \
+        }                                                  \
+                                                           \
+        if ((size_t)written == total)                      \
+        {                                                  \
+            return VECTOR_OK;                              \
+        }                                                  \
+                                                           \
+        /* Short writev: finish the remainder with plain writes */ \
+        size_t done = (size_t)written;                     \
+                                                           \
+        if (done < sizeof(header))                         \
+        {                                                  \
+            const vector_error_t err = vector_io_write_all(fd, (unsigned char *)&header + done, sizeof(header) - done); \
+                                                           \
+            if (err != VECTOR_OK)                          \
+            {                                              \
+                return err;                                \
+            }                                              \
+                                                           \
+            done = sizeof(header);                         \
+        }                                                  \
+                                                           \
+        return vector_io_write_all(fd, (unsigned char *)vector->data + (done - sizeof(header)), total - done); \
+    }                                                      \
+                                                           \
+    static inline vector_error_t vec_##NAME##_read(        \
+        vector_##NAME##_t *vector,                         \
+        const int fd                                       \
+    )                                                      \
+    {                                                      \
+        vector_io_header_t header;                         \
+        const vector_error_t header_err = vector_io_read_all(fd, &header, sizeof(header)); \
+                                                           \
+        if (header_err != VECTOR_OK)                       \
+        {                                                  \
+            return header_err;                             \
+        }                                                  \
+                                                           \
+        if (header.magic != FLUENT_LIBC_VECTOR_IO_MAGIC || header.element_size != sizeof(V)) \
+        {                                                  \
+            return VECTOR_ERR_FORMAT;                      \
+        }                                                  \
+                                                           \
+        const vector_error_t detach_err = vec_##NAME##_try_detach(vector); \
+                                                           \
+        if (detach_err != VECTOR_OK)                       \
+        {                                                  \
+            return detach_err;                             \
+        }                                                  \
+                                                           \
+        const vector_error_t reserve_err = vec_##NAME##_try_reserve(vector, (size_t)header.length); \
+                                                           \
+        if (reserve_err != VECTOR_OK)                      \
+        {                                                  \
+            return reserve_err;                            \
+        }                                                  \
+                                                           \
+        const vector_error_t payload_err = vector_io_read_all(fd, vector->data, sizeof(V) * (size_t)header.length); \
+                                                           \
+        if (payload_err != VECTOR_OK)                      \
+        {                                                  \
+            return payload_err;                            \
+        }                                                  \
+                                                           \
+        vector->length = (size_t)header.length;            \
+        return VECTOR_OK;                                  \
+    }                                                      \
+
+#endif // POSIX mmap + serialization support
+
+// == CHUNKED VECTORS ==
+// Segmented storage for giant vectors: a table of fixed-size chunks
+// (CHUNK_SIZE elements each) replaces the single buffer, so growth
+// allocates one new chunk and never moves existing data — no
+// realloc-and-copy stalls, no 2x transient RSS, and element addresses
+// stay stable across pushes. get/push do the two-level indexing;
+// for_each streams contiguously within each chunk. Growing the pointer
+// table itself is a realloc, but it only moves pointers, not elements.
+#define DEFINE_VECTOR_CHUNKED(V, NAME, CHUNK_SIZE)         \
+    typedef struct                                         \
+    {                                                      \
+        size_t length;                                     \
+        size_t chunk_count;                                \
+        size_t table_capacity;                             \
+        V **chunks;                                        \
+    } chunked_vector_##NAME##_t;                           \
+                                                           \
+    static inline void chk_##NAME##_init(                  \
+        chunked_vector_##NAME##_t *vector                  \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+        vector->chunk_count = 0;                           \
+        vector->table_capacity = 8;                        \
+        vector->chunks = (V **)malloc(sizeof(V *) * vector->table_capacity); \
+                                                           \
+        if (vector->chunks == NULL)                        \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline size_t chk_##NAME##_len(                 \
+        chunked_vector_##NAME##_t *vector                  \
+    )                                                      \
+    {                                                      \
+        return vector->length;                             \
+    }                                                      \
+                                                           \
+    static inline size_t chk_##NAME##_capacity(            \
+        chunked_vector_##NAME##_t *vector                  \
+    )                                                      \
+    {                                                      \
+        return vector->chunk_count * (CHUNK_SIZE);         \
+    }                                                      \
+                                                           \
+    static inline void chk_##NAME##_add_chunk(             \
+        chunked_vector_##NAME##_t *vector                  \
+    )                                                      \
+    {                                                      \
+        if (vector->chunk_count == vector->table_capacity) \
+        {                                                  \
+            const size_t new_table_capacity = vector->table_capacity * 2; \
+            V **new_chunks = (V **)realloc(vector->chunks, sizeof(V *) * new_table_capacity); \
+                                                           \
+            if (new_chunks == NULL)                        \
+            {                                              \
+                fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+                exit(1);                                   \
+            }                                              \
+                                                           \
+            vector->chunks = new_chunks;                   \
+            vector->table_capacity = new_table_capacity;   \
+        }                                                  \
+                                                           \
+        V *chunk = (V *)malloc(sizeof(V) * (CHUNK_SIZE));  \
+                                                           \
+        if (chunk == NULL)                                 \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->chunks[vector->chunk_count] = chunk;       \
+        vector->chunk_count++;                             \
+    }                                                      \
+                                                           \
+    static inline void chk_##NAME##_push(                  \
+        chunked_vector_##NAME##_t *vector,                 \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        if (vector->length == vector->chunk_count * (CHUNK_SIZE)) \
+        {                                                  \
+            chk_##NAME##_add_chunk(vector);                \
+        }                                                  \
+                                                           \
+        vector->chunks[vector->length / (CHUNK_SIZE)][vector->length % (CHUNK_SIZE)] = value; \
+        vector->length++;                                  \
+    }                                                      \
+                                                           \
+    static inline V chk_##NAME##_get(                      \
+        chunked_vector_##NAME##_t *vector,                 \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->chunks[index / (CHUNK_SIZE)][index % (CHUNK_SIZE)]; \
+    }                                                      \
+                                                           \
+    static inline V *chk_##NAME##_at(                      \
+        chunked_vector_##NAME##_t *vector,                 \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            return NULL;                                   \
+        }                                                  \
+                                                           \
+        return vector->chunks[index / (CHUNK_SIZE)] + index % (CHUNK_SIZE); \
+    }                                                      \
+                                                           \
+    static inline void chk_##NAME##_set(                   \
+        chunked_vector_##NAME##_t *vector,                 \
+        const size_t index,                                \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        if (index >= vector->length)                       \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->chunks[index / (CHUNK_SIZE)][index % (CHUNK_SIZE)] = value; \
+    }                                                      \
+                                                           \
+    static inline V chk_##NAME##_pop(                      \
+        chunked_vector_##NAME##_t *vector                  \
+    )                                                      \
+    {                                                      \
+        if (vector->length == 0)                           \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        vector->length--;                                  \
+        return vector->chunks[vector->length / (CHUNK_SIZE)][vector->length % (CHUNK_SIZE)]; \
+    }                                                      \
+                                                           \
+    static inline void chk_##NAME##_for_each(              \
+        chunked_vector_##NAME##_t *vector,                 \
+        void (*callback)(V value, size_t index)            \
+    )                                                      \
+    {                                                      \
+        size_t index = 0;                                  \
+                                                           \
+        /* Stream each chunk contiguously instead of dividing per element */ \
+        for (size_t c = 0; c < vector->chunk_count && index < vector->length; c++) \
+        {                                                  \
+            V *chunk = vector->chunks[c];                  \
+            const size_t remaining = vector->length - index; \
+            const size_t in_chunk = remaining < (CHUNK_SIZE) ? remaining : (CHUNK_SIZE); \
+                                                           \
+            for (size_t i = 0; i < in_chunk; i++)          \
+            {                                              \
+                callback(chunk[i], index + i);             \
+            }                                              \
+                                                           \
+            index += in_chunk;                             \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void chk_##NAME##_clear(                 \
+        chunked_vector_##NAME##_t *vector                  \
+    )                                                      \
+    {                                                      \
+        vector->length = 0;                                \
+    }                                                      \
+                                                           \
+    static inline void chk_##NAME##_destroy(               \
+        chunked_vector_##NAME##_t *vector,                 \
+        void (*free_fn)(V, size_t)                         \
+    )                                                      \
+    {                                                      \
+        if (free_fn != NULL)                               \
+        {                                                  \
+            for (size_t i = 0; i < vector->length; i++)    \
+            {                                              \
+                free_fn(vector->chunks[i / (CHUNK_SIZE)][i % (CHUNK_SIZE)], i); \
+            }                                              \
+        }                                                  \
+                                                           \
+        for (size_t c = 0; c < vector->chunk_count; c++)   \
+        {                                                  \
+            free(vector->chunks[c]);                       \
+        }                                                  \
+                                                           \
+        free(vector->chunks);                              \
+        vector->chunks = NULL;                             \
+        vector->length = 0;                                \
+        vector->chunk_count = 0;                           \
+        vector->table_capacity = 0;                        \
+    }                                                      \
+
+// == VECTOR SETS ==
+// Deduplicated vectors with O(1) membership: contiguous element storage
+// (cache-friendly iteration stays intact) plus an open-addressing index
+// of positions into it — the index stores offsets, not element copies.
+// HASH maps a V to a size_t and EQ compares two Vs for equality; both
+// may be functions or macros. The index never shrinks and supports no
+// removal, matching the push-only ID-list workloads it is meant for.
+//
+//     static size_t id_hash(unsigned long v) { return v * 2654435761u; }
+//     static int id_eq(unsigned long a, unsigned long b) { return a == b; }
+//     DEFINE_VECTOR_SET(unsigned long, idset, id_hash, id_eq);
+#define DEFINE_VECTOR_SET(V, NAME, HASH, EQ)               \
+    DEFINE_VECTOR(V, NAME)                                 \
+                                                           \
+    typedef struct                                         \
+    {                                                      \
+        vector_##NAME##_t items;                           \
+        size_t *index;                                     \
+        size_t index_capacity;                             \
+    } vector_set_##NAME##_t;                               \
+                                                           \
+    static inline void vset_##NAME##_init(                 \
+        vector_set_##NAME##_t *set,                        \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_init(&set->items, initial_capacity, growth_factor); \
+                                                           \
+        set->index_capacity = 16;                          \
+                                                           \
+        while (set->index_capacity < initial_capacity * 2) \
+        {                                                  \
+            set->index_capacity *= 2;                      \
+        }                                                  \
+                                                           \
+        set->index = (size_t *)calloc(set->index_capacity, sizeof(size_t)); \
+                                                           \
+        if (set->index == NULL)                            \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline size_t vset_##NAME##_len(                \
+        vector_set_##NAME##_t *set                         \
+    )                                                      \
+    {                                                      \
+        return set->items.length;                          \
+    }                                                      \
+                                                           \
+    static inline int vset_##NAME##_contains(              \
+        vector_set_##NAME##_t *set,                        \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        const size_t mask = set->index_capacity - 1;       \
+        size_t slot = (size_t)HASH(value) & mask;          \
+                                                           \
+        while (set->index[slot] != 0)                      \
+        {                                                  \
+            if (EQ(set->items.data[set->index[slot] - 1], value)) \
+            {                                              \
+                return 1;                                  \
+            }                                              \
+                                                           \
+            slot = (slot + 1) & mask;                      \
+        }                                                  \
+                                                           \
+        return 0;                                          \
+    }                                                      \
+                                                           \
+    static inline void vset_##NAME##_rehash(               \
+        vector_set_##NAME##_t *set                         \
+    )                                                      \
+    {                                                      \
+        const size_t new_capacity = set->index_capacity * 2; \
+        size_t *new_index = (size_t *)calloc(new_capacity, sizeof(size_t)); \
+                                                           \
+        if (new_index == NULL)                             \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        const size_t mask = new_capacity - 1;              \
+                                                           \
+        for (size_t i = 0; i < set->items.length; i++)     \
+        {                                                  \
+            size_t slot = (size_t)HASH(set->items.data[i]) & mask; \
+                                                           \
+            while (new_index[slot] != 0)                   \
+            {                                              \
+                slot = (slot + 1) & mask;                  \
+            }                                              \
+                                                           \
+            new_index[slot] = i + 1;                       \
+        }                                                  \
+                                                           \
+        free(set->index);                                  \
+        set->index = new_index;                            \
+        set->index_capacity = new_capacity;                \
+    }                                                      \
+                                                           \
+    static inline int vset_##NAME##_push_unique(           \
+        vector_set_##NAME##_t *set,                        \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        /* Keep the probe chains short: grow at ~70% load */ \
+        if (set->items.length * 10 >= set->index_capacity * 7) \
+        {                                                  \
+            vset_##NAME##_rehash(set);                     \
+        }                                                  \
+                                                           \
+        const size_t mask = set->index_capacity - 1;       \
+        size_t slot = (size_t)HASH(value) & mask;          \
+                                                           \
+        while (set->index[slot] != 0)                      \
+        {                                                  \
+            if (EQ(set->items.data[set->index[slot] - 1], value)) \
+            {                                              \
+                return 0;                                  \
+            }                                              \
+                                                           \
+            slot = (slot + 1) & mask;                      \
+        }                                                  \
+                                                           \
+        vec_##NAME##_push(&set->items, value);             \
+        set->index[slot] = set->items.length;              \
+        return 1;                                          \
+    }                                                      \
+                                                           \
+    static inline V vset_##NAME##_get(                     \
+        vector_set_##NAME##_t *set,                        \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        return vec_##NAME##_get(&set->items, index);       \
+    }                                                      \
+                                                           \
+    static inline void vset_##NAME##_destroy(              \
+        vector_set_##NAME##_t *set,                        \
+        void (*free_fn)(V, size_t)                         \
+    )                                                      \
+    {                                                      \
+        vec_##NAME##_destroy(&set->items, free_fn);        \
+        free(set->index);                                  \
+        set->index = NULL;                                 \
+        set->index_capacity = 0;                           \
+    }                                                      \
+
+// == DEQUE VECTORS ==
+// Ring-buffer variant for FIFO/queue workloads: a head offset makes
+// push_front/pop_front O(1) amortized instead of an O(n) shift. The
+// contents live in at most two contiguous segments; growth linearizes
+// them into the new buffer with two memcpys, so the growth path stays
+// memcpy-friendly. Shares the growth-factor semantics of DEFINE_VECTOR.
+#define DEFINE_VECTOR_DEQUE(V, NAME)                       \
+    typedef struct                                         \
+    {                                                      \
+        size_t length;                                     \
+        size_t capacity;                                   \
+        size_t head;                                       \
+        double growth_factor;                              \
+        V *data;                                           \
+    } deque_vector_##NAME##_t;                             \
+                                                           \
+    static inline void deq_##NAME##_init(                  \
+        deque_vector_##NAME##_t *deque,                    \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        if (initial_capacity == 0)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Initial capacity cannot be 0 (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        deque->length = 0;                                 \
+        deque->capacity = initial_capacity;                \
+        deque->head = 0;                                   \
+        deque->growth_factor = growth_factor;              \
+        deque->data = (V *)malloc(sizeof(V) * initial_capacity); \
+                                                           \
+        if (deque->data == NULL)                           \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline size_t deq_##NAME##_len(                 \
+        deque_vector_##NAME##_t *deque                     \
+    )                                                      \
+    {                                                      \
+        return deque->length;                              \
+    }                                                      \
+                                                           \
+    static inline size_t deq_##NAME##_capacity(            \
+        deque_vector_##NAME##_t *deque                     \
+    )                                                      \
+    {                                                      \
+        return deque->capacity;                            \
+    }                                                      \
+                                                           \
+    static inline void deq_##NAME##_grow(                  \
+        deque_vector_##NAME##_t *deque                     \
+    )                                                      \
+    {                                                      \
+        size_t new_capacity = (size_t)(deque->capacity * deque->growth_factor); \
+                                                           \
+        if (new_capacity <= deque->capacity)               \
+        {                                                  \
+            new_capacity = deque->capacity + 1;            \
+        }                                                  \
+                                                           \
+        V *new_data = (V *)malloc(sizeof(V) * new_capacity); \
+                                                           \
+        if (new_data == NULL)                              \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        /* Linearize the (up to) two segments into the new buffer */ \
+        const size_t first = deque->capacity - deque->head < deque->length \
+            ? deque->capacity - deque->head                \
+            : deque->length;                               \
+        memcpy(new_data, deque->data + deque->head, sizeof(V) * first); \
+        memcpy(new_data + first, deque->data, sizeof(V) * (deque->length - first)); \
+                                                           \
+        free(deque->data);                                 \
+        deque->data = new_data;                            \
+        deque->capacity = new_capacity;                    \
+        deque->head = 0;                                   \
+    }                                                      \
+                                                           \
+    static inline void deq_##NAME##_push(                  \
+        deque_vector_##NAME##_t *deque,                    \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        if (deque->length == deque->capacity)              \
+        {                                                  \
+            deq_##NAME##_grow(deque);                      \
+        }                                                  \
+                                                           \
+        deque->data[(deque->head + deque->length) % deque->capacity] = value; \
+        deque->length++;                                   \
+    }                                                      \
+                                                           \
+    static inline void deq_##NAME##_push_front(            \
+        deque_vector_##NAME##_t *deque,                    \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        if (deque->length == deque->capacity)              \
+        {                                                  \
+            deq_##NAME##_grow(deque);                      \
+        }                                                  \
+                                                           \
+        deque->head = (deque->head + deque->capacity - 1) % deque->capacity; \
+        deque->data[deque->head] = value;                  \
+        deque->length++;                                   \
+    }                                                      \
+                                                           \
+    static inline V deq_##NAME##_pop(                      \
+        deque_vector_##NAME##_t *deque                     \
+    )                                                      \
+    {                                                      \
+        if (deque->length == 0)                            \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        deque->length--;                                   \
+        return deque->data[(deque->head + deque->length) % deque->capacity]; \
+    }                                                      \
+                                                           \
+    static inline V deq_##NAME##_pop_front(                \
+        deque_vector_##NAME##_t *deque                     \
+    )                                                      \
+    {                                                      \
+        if (deque->length == 0)                            \
+        {                                                  \
+            fprintf(stderr, "Error: Cannot pop from empty vector (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        V value = deque->data[deque->head];                \
+        deque->head = (deque->head + 1) % deque->capacity; \
+        deque->length--;                                   \
+        return value;                                      \
+    }                                                      \
+                                                           \
+    static inline V deq_##NAME##_get(                      \
+        deque_vector_##NAME##_t *deque,                    \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= deque->length)                        \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return deque->data[(deque->head + index) % deque->capacity]; \
+    }                                                      \
+                                                           \
+    static inline void deq_##NAME##_for_each(              \
+        deque_vector_##NAME##_t *deque,                    \
+        void (*callback)(V value, size_t index)            \
+    )                                                      \
+    {                                                      \
+        for (size_t i = 0; i < deque->length; i++)         \
+        {                                                  \
+            callback(deque->data[(deque->head + i) % deque->capacity], i); \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void deq_##NAME##_clear(                 \
+        deque_vector_##NAME##_t *deque                     \
+    )                                                      \
+    {                                                      \
+        deque->length = 0;                                 \
+        deque->head = 0;                                   \
+    }                                                      \
+                                                           \
+    static inline void deq_##NAME##_destroy(               \
+        deque_vector_##NAME##_t *deque,                    \
+        void (*free_fn)(V, size_t)                         \
+    )                                                      \
+    {                                                      \
+        if (free_fn != NULL)                               \
+        {                                                  \
+            for (size_t i = 0; i < deque->length; i++)     \
+            {                                              \
+                free_fn(deque->data[(deque->head + i) % deque->capacity], i); \
+            }                                              \
+        }                                                  \
+                                                           \
+        free(deque->data);                                 \
+        deque->data = NULL;                                \
+        deque->length = 0;                                 \
+        deque->capacity = 0;                               \
+        deque->head = 0;                                   \
+    }                                                      \
+
+// == BIT VECTORS ==
+// Bit-packed specialization for boolean vectors: 64 elements per
+// uint64_t word, so selection masks take 1/8th the memory and
+// bandwidth of an unsigned char vector. Word-level and/or/not combine
+// 64 predicates per operation, and count_set uses popcount. Uses the
+// bitv_ prefix on a bitvector_<NAME>_t.
+
+// Portable 64-bit popcount; GCC/Clang get the builtin (a single
+// instruction where the target has one), everyone else gets the
+// classic SWAR reduction.
+#if defined(__GNUC__) || defined(__clang__)
+static inline size_t vector_popcount64(const uint64_t word)
+{
+    return (size_t)__builtin_popcountll(word);
+}
+#else
+static inline size_t vector_popcount64(uint64_t word)
+{
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (size_t)((word * 0x0101010101010101ULL) >> 56);
+}
+#endif
+
+#define DEFINE_BITVECTOR(NAME)                             \
+    typedef struct                                         \
+    {                                                      \
+        size_t length;        /* in bits */                \
+        size_t word_capacity; /* in 64-bit words */        \
+        double growth_factor;                              \
+        uint64_t *words;                                   \
+    } bitvector_##NAME##_t;                                \
+                                                           \
+    static inline void bitv_##NAME##_init(                 \
+        bitvector_##NAME##_t *bits,                        \
+        const size_t initial_bit_capacity,                 \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        if (initial_bit_capacity == 0)                     \
+        {                                                  \
+            fprintf(stderr, "Error: Initial capacity cannot be 0 (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        bits->length = 0;                                  \
+        bits->word_capacity = (initial_bit_capacity + 63) / 64; \
+        bits->growth_factor = growth_factor;               \
+        bits->words = (uint64_t *)calloc(bits->word_capacity, sizeof(uint64_t)); \
+                                                           \
+        if (bits->words == NULL)                           \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline size_t bitv_##NAME##_len(                \
+        bitvector_##NAME##_t *bits                         \
+    )                                                      \
+    {                                                      \
+        return bits->length;                               \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_reserve_words(        \
+        bitvector_##NAME##_t *bits,                        \
+        const size_t needed_words                          \
+    )                                                      \
+    {                                                      \
+        if (needed_words <= bits->word_capacity)           \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        size_t new_capacity = (size_t)(bits->word_capacity * bits->growth_factor); \
+                                                           \
+        if (new_capacity < needed_words)                   \
+        {                                                  \
+            new_capacity = needed_words;                   \
+        }                                                  \
+                                                           \
+        uint64_t *new_words = (uint64_t *)realloc(bits->words, sizeof(uint64_t) * new_capacity); \
+                                                           \
+        if (new_words == NULL)                             \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        memset(new_words + bits->word_capacity, 0, sizeof(uint64_t) * (new_capacity - bits->word_capacity)); \
+        bits->words = new_words;                           \
+        bits->word_capacity = new_capacity;                \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_push_bit(             \
+        bitvector_##NAME##_t *bits,                        \
+        const int bit                                      \
+    )                                                      \
+    {                                                      \
+        bitv_##NAME##_reserve_words(bits, bits->length / 64 + 1); \
+                                                           \
+        if (bit)                                           \
+        {                                                  \
+            bits->words[bits->length / 64] |= (uint64_t)1 << (bits->length % 64); \
+        }                                                  \
+        else                                               \
+        {                                                  \
+            bits->words[bits->length / 64] &= ~((uint64_t)1 << (bits->length % 64)); \
+        }                                                  \
+                                                           \
+        bits->length++;                                    \
+    }                                                      \
+                                                           \
+    static inline int bitv_##NAME##_get_bit(               \
+        bitvector_##NAME##_t *bits,                        \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= bits->length)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return (int)((bits->words[index / 64] >> (index % 64)) & 1); \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_set_bit(              \
+        bitvector_##NAME##_t *bits,                        \
+        const size_t index,                                \
+        const int bit                                      \
+    )                                                      \
+    {                                                      \
+        if (index >= bits->length)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        if (bit)                                           \
+        {                                                  \
+            bits->words[index / 64] |= (uint64_t)1 << (index % 64); \
+        }                                                  \
+        else                                               \
+        {                                                  \
+            bits->words[index / 64] &= ~((uint64_t)1 << (index % 64)); \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_and(                  \
+        bitvector_##NAME##_t *dst,                         \
+        bitvector_##NAME##_t *a,                           \
+        bitvector_##NAME##_t *b                            \
+    )                                                      \
+    {                                                      \
+        if (a->length != b->length)                        \
+        {                                                  \
+            fprintf(stderr, "Error: Bitvector length mismatch (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        const size_t words = (a->length + 63) / 64;        \
+        bitv_##NAME##_reserve_words(dst, words == 0 ? 1 : words); \
+                                                           \
+        for (size_t i = 0; i < words; i++)                 \
+        {                                                  \
+            dst->words[i] = a->words[i] & b->words[i];     \
+        }                                                  \
+                                                           \
+        dst->length = a->length;                           \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_or(                   \
+        bitvector_##NAME##_t *dst,                         \
+        bitvector_##NAME##_t *a,                           \
+        bitvector_##NAME##_t *b                            \
+    )                                                      \
+    {                                                      \
+        if (a->length != b->length)                        \
+        {                                                  \
+            fprintf(stderr, "Error: Bitvector length mismatch (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        const size_t words = (a->length + 63) / 64;        \
+        bitv_##NAME##_reserve_words(dst, words == 0 ? 1 : words); \
+                                                           \
+        for (size_t i = 0; i < words; i++)                 \
+        {                                                  \
+            dst->words[i] = a->words[i] | b->words[i];     \
+        }                                                  \
+                                                           \
+        dst->length = a->length;                           \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_not(                  \
+        bitvector_##NAME##_t *dst,                         \
+        bitvector_##NAME##_t *src                          \
+    )                                                      \
+    {                                                      \
+        const size_t words = (src->length + 63) / 64;      \
+        bitv_##NAME##_reserve_words(dst, words == 0 ? 1 : words); \
+                                                           \
+        for (size_t i = 0; i < words; i++)                 \
+        {                                                  \
+            dst->words[i] = ~src->words[i];                \
+        }                                                  \
+                                                           \
+        /* Clear the unused high bits of the last word so  \
+           count_set stays exact */                        \
+        if (src->length % 64 != 0)                         \
+        {                                                  \
+            dst->words[words - 1] &= ((uint64_t)1 << (src->length % 64)) - 1; \
+        }                                                  \
+                                                           \
+        dst->length = src->length;                         \
+    }                                                      \
+                                                           \
+    static inline size_t bitv_##NAME##_count_set(          \
+        bitvector_##NAME##_t *bits                         \
+    )                                                      \
+    {                                                      \
+        const size_t words = (bits->length + 63) / 64;     \
+        size_t count = 0;                                  \
+                                                           \
+        for (size_t i = 0; i < words; i++)                 \
+        {                                                  \
+            uint64_t word = bits->words[i];                \
+                                                           \
+            if (i == words - 1 && bits->length % 64 != 0)  \
+            {                                              \
+                word &= ((uint64_t)1 << (bits->length % 64)) - 1; \
+            }                                              \
+                                                           \
+            count += vector_popcount64(word);              \
+        }                                                  \
+                                                           \
+        return count;                                      \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_clear(                \
+        bitvector_##NAME##_t *bits                         \
+    )                                                      \
+    {                                                      \
+        bits->length = 0;                                  \
+    }                                                      \
+                                                           \
+    static inline void bitv_##NAME##_destroy(              \
+        bitvector_##NAME##_t *bits                         \
+    )                                                      \
+    {                                                      \
+        free(bits->words);                                 \
+        bits->words = NULL;                                \
+        bits->length = 0;                                  \
+        bits->word_capacity = 0;                           \
+    }                                                      \
+
+// == CONCURRENT MPSC VECTORS (C11 atomics) ==
+// Multi-producer append without a mutex: producers reserve a slot with
+// an atomic fetch-add, copy their element, then commit in slot order so
+// the committed length is always a fully-written prefix. Growth
+// quiesces producers (grow flag + active-writer count), reallocates,
+// and lets them resume — no locks on the fast path. The read side is
+// single-consumer: len/get/for_each observe the committed prefix.
+// Compiled out when the toolchain lacks C11 atomics.
+#if !defined(__STDC_NO_ATOMICS__) && !defined(__cplusplus)
+
+#include <stdatomic.h>
+
+// Spin-wait hint: yield the CPU where POSIX is visible so contended
+// producers make progress even with fewer cores than threads.
+#ifndef FLUENT_LIBC_VECTOR_CPU_RELAX_DEFINED
+#   define FLUENT_LIBC_VECTOR_CPU_RELAX_DEFINED 1
+#   ifdef FLUENT_LIBC_VECTOR_HAS_POSIX
+#       include <sched.h>
+        static inline void vector_cpu_relax(void)
+        {
+            sched_yield();
+        }
+#   else
+        static inline void vector_cpu_relax(void)
+        {
+        }
+#   endif
+#endif
+
+#define DEFINE_VECTOR_CONCURRENT(V, NAME)                  \
+    typedef struct                                         \
+    {                                                      \
+        _Atomic size_t length;                             \
+        _Atomic size_t reserved;                           \
+        size_t capacity;                                   \
+        double growth_factor;                              \
+        V *data;                                           \
+        _Atomic int growing;                               \
+        _Atomic size_t active;                             \
+    } concurrent_vector_##NAME##_t;                        \
+                                                           \
+    static inline void cvec_##NAME##_init(                 \
+        concurrent_vector_##NAME##_t *vector,              \
+        const size_t initial_capacity,                     \
+        const double growth_factor                         \
+    )                                                      \
+    {                                                      \
+        if (initial_capacity == 0)                         \
+        {                                                  \
+            fprintf(stderr, "Error: Initial capacity cannot be 0 (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        atomic_init(&vector->length, 0);                   \
+        atomic_init(&vector->reserved, 0);                 \
+        atomic_init(&vector->growing, 0);                  \
+        atomic_init(&vector->active, 0);                   \
+        vector->capacity = initial_capacity;               \
+        vector->growth_factor = growth_factor;             \
+        vector->data = (V *)malloc(sizeof(V) * initial_capacity); \
+                                                           \
+        if (vector->data == NULL)                          \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void cvec_##NAME##_grow_to(              \
+        concurrent_vector_##NAME##_t *vector,              \
+        const size_t needed                                \
+    )                                                      \
+    {                                                      \
+        int expected = 0;                                  \
+                                                           \
+        while (!atomic_compare_exchange_weak(&vector->growing, &expected, 1)) \
+        {                                                  \
+            expected = 0;                                  \
+            vector_cpu_relax();                            \
+        }                                                  \
+                                                           \
+        /* Wait for in-flight writers to drain before moving the buffer */ \
+        while (atomic_load_explicit(&vector->active, memory_order_acquire) != 0) \
+        {                                                  \
+            vector_cpu_relax();                            \
+        }                                                  \
+                                                           \
+        if (needed > vector->capacity)                     \
+        {                                                  \
+            size_t new_capacity = vector->capacity;        \
+            const size_t target = atomic_load_explicit(&vector->reserved, memory_order_relaxed); \
+                                                           \
+            while (new_capacity < (target > needed ? target : needed)) \
+            {                                              \
+                const size_t grown = (size_t)(new_capacity * vector->growth_factor); \
+                new_capacity = grown > new_capacity ? grown : needed; \
+            }                                              \
+                                                           \
+            V *new_data = (V *)realloc(vector->data, sizeof(V) * new_capacity); \
+                                                           \
+            if (new_data == NULL)                          \
+            {                                              \
+                free(vector->data);                        \
+                fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+                exit(1);                                   \
+            }                                              \
+                                                           \
+            vector->data = new_data;                       \
+            vector->capacity = new_capacity;               \
+        }                                                  \
+                                                           \
+        atomic_store_explicit(&vector->growing, 0, memory_order_release); \
+    }                                                      \
+                                                           \
+    static inline void cvec_##NAME##_push(                 \
+        concurrent_vector_##NAME##_t *vector,              \
+        V value                                            \
+    )                                                      \
+    {                                                      \
+        const size_t index = atomic_fetch_add_explicit(&vector->reserved, 1, memory_order_relaxed); \
+                                                           \
+        for (;;)                                           \
+        {                                                  \
+            while (atomic_load_explicit(&vector->growing, memory_order_acquire)) \
+            {                                              \
+                vector_cpu_relax();                        \
+            }                                              \
+                                                           \
+            atomic_fetch_add_explicit(&vector->active, 1, memory_order_acq_rel); \
+                                                           \
+            /* Re-check: a grower that won the race waits for us otherwise */ \
+            if (atomic_load_explicit(&vector->growing, memory_order_acquire)) \
+            {                                              \
+                atomic_fetch_sub_explicit(&vector->active, 1, memory_order_acq_rel); \
+                continue;                                  \
+            }                                              \
+                                                           \
+            if (index >= vector->capacity)                 \
+            {                                              \
+                atomic_fetch_sub_explicit(&vector->active, 1, memory_order_acq_rel); \
+                cvec_##NAME##_grow_to(vector, index + 1);  \
+                continue;                                  \
+            }                                              \
+                                                           \
+            vector->data[index] = value;                   \
+            atomic_fetch_sub_explicit(&vector->active, 1, memory_order_acq_rel); \
+            break;                                         \
+        }                                                  \
+                                                           \
+        /* Commit in slot order so length is a contiguous prefix */ \
+        while (atomic_load_explicit(&vector->length, memory_order_acquire) != index) \
+        {                                                  \
+            vector_cpu_relax();                            \
+        }                                                  \
+                                                           \
+        atomic_store_explicit(&vector->length, index + 1, memory_order_release); \
+    }                                                      \
+                                                           \
+    static inline size_t cvec_##NAME##_len(                \
+        concurrent_vector_##NAME##_t *vector               \
+    )                                                      \
+    {                                                      \
+        return atomic_load_explicit(&vector->length, memory_order_acquire); \
+    }                                                      \
+                                                           \
+    static inline V cvec_##NAME##_get(                     \
+        concurrent_vector_##NAME##_t *vector,              \
+        const size_t index                                 \
+    )                                                      \
+    {                                                      \
+        if (index >= cvec_##NAME##_len(vector))            \
+        {                                                  \
+            fprintf(stderr, "Error: Index out of bounds (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        return vector->data[index];                        \
+    }                                                      \
+                                                           \
+    static inline void cvec_##NAME##_for_each(             \
+        concurrent_vector_##NAME##_t *vector,              \
+        void (*callback)(V value, size_t index)            \
+    )                                                      \
+    {                                                      \
+        const size_t committed = cvec_##NAME##_len(vector); \
+                                                           \
+        for (size_t i = 0; i < committed; i++)             \
+        {                                                  \
+            callback(vector->data[i], i);                  \
+        }                                                  \
+    }                                                      \
+                                                           \
+    static inline void cvec_##NAME##_destroy(              \
+        concurrent_vector_##NAME##_t *vector,              \
+        void (*free_fn)(V, size_t)                         \
+    )                                                      \
+    {                                                      \
+        if (free_fn != NULL)                               \
+        {                                                  \
+            const size_t committed = cvec_##NAME##_len(vector); \
+                                                           \
+            for (size_t i = 0; i < committed; i++)         \
+            {                                              \
+                free_fn(vector->data[i], i);               \
+            }                                              \
+        }                                                  \
+                                                           \
+        free(vector->data);                                \
+        vector->data = NULL;                               \
+        atomic_store(&vector->length, 0);                  \
+        atomic_store(&vector->reserved, 0);                \
+        vector->capacity = 0;                              \
+    }                                                      \
+
+#endif // C11 atomics
+
+// == PARALLEL ITERATION (C11 threads) ==
+// vec_<NAME>_par_for_each and vec_<NAME>_par_reduce partition
+// [0, length) into cache-line-aligned contiguous chunks and run one
+// worker thread per chunk, so each task streams sequential memory.
+// par_reduce folds each chunk locally, then folds the per-thread
+// partials into init — the reduction function must be associative, and
+// init enters the reduction exactly once regardless of thread count.
+// Compiled out when the toolchain lacks C11 threads.
+#if !defined(__STDC_NO_THREADS__) && !defined(__cplusplus)
+
+#include <threads.h>
+
+#define DEFINE_VECTOR_PARALLEL(V, NAME)                    \
+    DEFINE_VECTOR(V, NAME)                                 \
+                                                           \
+    typedef struct                                         \
+    {                                                      \
+        V *data;                                           \
+        size_t start;                                      \
+        size_t end;                                        \
+        void (*callback)(V *value, size_t index, void *ctx); \
+        V (*reduce_fn)(V acc, V value, void *ctx);         \
+        V accumulator;                                     \
+        void *ctx;                                         \
+    } vec_##NAME##_par_task_t;                             \
+                                                           \
+    static int vec_##NAME##_par_worker(void *arg)          \
+    {                                                      \
+        vec_##NAME##_par_task_t *task = (vec_##NAME##_par_task_t *)arg; \
+                                                           \
+        for (size_t i = task->start; i < task->end; i++)   \
+        {                                                  \
+            task->callback(task->data + i, i, task->ctx);  \
+        }                                                  \
+                                                           \
+        return 0;                                          \
+    }                                                      \
+                                                           \
+    static int vec_##NAME##_par_reduce_worker(void *arg)   \
+    {                                                      \
+        vec_##NAME##_par_task_t *task = (vec_##NAME##_par_task_t *)arg; \
+                                                           \
+        for (size_t i = task->start; i < task->end; i++)   \
+        {                                                  \
+            task->accumulator = task->reduce_fn(task->accumulator, task->data[i], task->ctx); \
+        }                                                  \
+                                                           \
+        return 0;                                          \
+    }                                                      \
+                                                           \
+    static inline size_t vec_##NAME##_par_chunk(           \
+        const size_t length,                               \
+        const size_t n_threads                             \
+    )                                                      \
+    {                                                      \
+        /* Round chunks up to a whole cache line of elements */ \
+        const size_t line = sizeof(V) < 64 ? 64 / sizeof(V) : 1; \
+        const size_t raw = (length + n_threads - 1) / n_threads; \
+        return ((raw + line - 1) / line) * line;           \
+    }                                                      \
+                                                           \
+    static inline void vec_##NAME##_par_for_each(          \
+        vector_##NAME##_t *vector,                         \
+        void (*callback)(V *value, size_t index, void *ctx), \
+        void *ctx,                                         \
+        size_t n_threads                                   \
+    )                                                      \
+    {                                                      \
+        if (vector->length == 0)                           \
+        {                                                  \
+            return;                                        \
+        }                                                  \
+                                                           \
+        if (n_threads < 2 || vector->length < n_threads)   \
+        {                                                  \
+            for (size_t i = 0; i < vector->length; i++)    \
+            {                                              \
+                callback(vector->data + i, i, ctx);        \
+            }                                              \
+                                                           \
+            return;                                        \
+        }                                                  \
+                                                           \
+        const size_t chunk = vec_##NAME##_par_chunk(vector->length, n_threads); \
+        vec_##NAME##_par_task_t *tasks = (vec_##NAME##_par_task_t *)malloc(sizeof(vec_##NAME##_par_task_t) * n_threads); \
+        thrd_t *threads = (thrd_t *)malloc(sizeof(thrd_t) * n_threads); \
+                                                           \
+        if (tasks == NULL || threads == NULL)              \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        size_t spawned = 0;                                \
+                                                           \
+        for (size_t t = 0; t < n_threads; t++)             \
+        {                                                  \
+            const size_t start = t * chunk;                \
+                                                           \
+            if (start >= vector->length)                   \
+            {                                              \
+                break;                                     \
+            }                                              \
+                                                           \
+            const size_t end = start + chunk;              \
+            tasks[t].data = vector->data;                  \
+            tasks[t].start = start;                        \
+            tasks[t].end = end < vector->length ? end : vector->length; \
+            tasks[t].callback = callback;                  \
+            tasks[t].reduce_fn = NULL;                     \
+            tasks[t].ctx = ctx;                            \
+                                                           \
+            if (thrd_create(&threads[t], vec_##NAME##_par_worker, &tasks[t]) != thrd_success) \
+            {                                              \
+                /* Fall back to running the remaining range inline */ \
+                tasks[t].end = vector->length;             \
+                vec_##NAME##_par_worker(&tasks[t]);        \
+                break;                                     \
+            }                                              \
+                                                           \
+            spawned++;                                     \
+        }                                                  \
+                                                           \
+        for (size_t t = 0; t < spawned; t++)               \
+        {                                                  \
+            thrd_join(threads[t], NULL);                   \
+        }                                                  \
+                                                           \
+        free(threads);                                     \
+        free(tasks);                                       \
+    }                                                      \
+                                                           \
+    static inline V vec_##NAME##_par_reduce(               \
+        vector_##NAME##_t *vector,                         \
+        V (*reduce_fn)(V acc, V value, void *ctx),         \
+        V init,                                            \
+        void *ctx,                                         \
+        size_t n_threads                                   \
+    )                                                      \
+    {                                                      \
+        V result = init;                                   \
+                                                           \
+        if (vector->length == 0)                           \
+        {                                                  \
+            return result;                                 \
+        }                                                  \
+                                                           \
+        if (n_threads < 2 || vector->length < n_threads)   \
+        {                                                  \
+            for (size_t i = 0; i < vector->length; i++)    \
+            {                                              \
+                result = reduce_fn(result, vector->data[i], ctx); \
+            }                                              \
+                                                           \
+            return result;                                 \
+        }                                                  \
+                                                           \
+        const size_t chunk = vec_##NAME##_par_chunk(vector->length, n_threads); \
+        vec_##NAME##_par_task_t *tasks = (vec_##NAME##_par_task_t *)malloc(sizeof(vec_##NAME##_par_task_t) * n_threads); \
+        thrd_t *threads = (thrd_t *)malloc(sizeof(thrd_t) * n_threads); \
+                                                           \
+        if (tasks == NULL || threads == NULL)              \
+        {                                                  \
+            fprintf(stderr, "Error: Out of memory (fluent_libc: vector_t)\n"); \
+            exit(1);                                       \
+        }                                                  \
+                                                           \
+        size_t spawned = 0;                                \
+        size_t used = 0;                                   \
+                                                           \
+        for (size_t t = 0; t < n_threads; t++)             \
+        {                                                  \
+            const size_t start = t * chunk;                \
+                                                           \
+            if (start >= vector->length)                   \
+            {                                              \
+                break;                                     \
+            }                                              \
+                                                           \
+            const size_t end = start + chunk;              \
+            tasks[t].data = vector->data;                  \
+            /* Seed from the chunk's first element so init is not \
+               absorbed once per chunk */                  \
+            tasks[t].start = start + 1;                    \
+            tasks[t].end = end < vector->length ? end : vector->length; \
+            tasks[t].callback = NULL;                      \
+            tasks[t].reduce_fn = reduce_fn;                \
+            tasks[t].accumulator = vector->data[start];    \
+            tasks[t].ctx = ctx;                            \
+            used = t + 1;                                  \
+                                                           \
+            if (thrd_create(&threads[t], vec_##NAME##_par_reduce_worker, &tasks[t]) != thrd_success) \
+            {                                              \
+                /* Fall back to reducing the remaining range inline */ \
+                tasks[t].end = vector->length;             \
+                vec_##NAME##_par_reduce_worker(&tasks[t]); \
+                break;                                     \
+            }                                              \
+                                                           \
+            spawned++;                                     \
+        }                                                  \
+                                                           \
+        for (size_t t = 0; t < spawned; t++)               \
+        {                                                  \
+            thrd_join(threads[t], NULL);                   \
+        }                                                  \
+                                                           \
+        /* Fold the per-chunk partials into init, so init enters the \
+           reduction exactly once — same as the sequential path */ \
+        for (size_t t = 0; t < used; t++)                  \
+        {                                                  \
+            result = reduce_fn(result, tasks[t].accumulator, ctx); \
+        }                                                  \
+                                                           \
+        free(threads);                                     \
+        free(tasks);                                       \
+        return result;                                     \
+    }                                                      \
+
+#endif // C11 threads
 
 #ifndef FLUENT_LIBC_VECTOR_GENERIC_DEFINED
 #   define FLUENT_LIBC_VECTOR_GENERIC_DEFINED 1
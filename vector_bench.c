@@ -0,0 +1,250 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type `show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type `show c' for details.
+*/
+
+// ============= FLUENT LIB C =============
+// vector_t microbenchmarks
+// ----------------------------------------
+// Reproducible microbenchmarks for the vector_t API, built as the
+// `vector_bench` CMake target. Covers:
+// - vec_<T>_push throughput (int, 64-byte struct, generic pointer)
+// - bulk append via vec_<T>_push_n
+// - vec_<T>_for_each scan bandwidth
+// - growth/realloc behavior across growth factors
+// - checked vec_<T>_get vs. raw-pointer access
+//
+// Each benchmark reports ns/op and, where it streams memory, GB/s.
+// Pass an element count as argv[1] to scale the runs (default 1M).
+// ----------------------------------------
+
+// clock_gettime needs POSIX visibility under strict -std=c11
+#define _POSIX_C_SOURCE 199309L
+
+#include "vector.h"
+
+#include <time.h>
+
+typedef struct
+{
+    unsigned char bytes[64];
+} record64_t;
+
+DEFINE_VECTOR(int, bench_int);
+DEFINE_VECTOR(record64_t, bench_rec);
+DEFINE_VECTOR(double, bench_f64);
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void report(const char *name, const double elapsed_ns, const size_t ops, const size_t bytes)
+{
+    printf("%-34s %10.2f ns/op", name, elapsed_ns / (double)ops);
+
+    if (bytes > 0)
+    {
+        printf("  %8.2f GB/s", (double)bytes / elapsed_ns);
+    }
+
+    printf("\n");
+}
+
+// Sink to keep the optimizer from deleting whole loops.
+static volatile double g_sink;
+
+static void bench_push_int(const size_t n)
+{
+    vector_bench_int_t v;
+    vec_bench_int_init(&v, 16, 2.0);
+
+    const double start = now_ns();
+
+    for (size_t i = 0; i < n; i++)
+    {
+        vec_bench_int_push(&v, (int)i);
+    }
+
+    report("push (int)", now_ns() - start, n, n * sizeof(int));
+    g_sink = (double)vec_bench_int_get(&v, n - 1);
+    vec_bench_int_destroy(&v, NULL);
+}
+
+static void bench_push_record(const size_t n)
+{
+    vector_bench_rec_t v;
+    vec_bench_rec_init(&v, 16, 2.0);
+
+    record64_t rec;
+    memset(&rec, 0x5a, sizeof(rec));
+
+    const double start = now_ns();
+
+    for (size_t i = 0; i < n; i++)
+    {
+        vec_bench_rec_push(&v, rec);
+    }
+
+    report("push (64-byte struct)", now_ns() - start, n, n * sizeof(record64_t));
+    g_sink = (double)vec_bench_rec_get(&v, n - 1).bytes[0];
+    vec_bench_rec_destroy(&v, NULL);
+}
+
+static void bench_push_generic(const size_t n)
+{
+    vector_generic_t v;
+    vec_generic_init(&v, 16, 2.0);
+
+    int payload = 42;
+
+    const double start = now_ns();
+
+    for (size_t i = 0; i < n; i++)
+    {
+        vec_generic_push(&v, &payload);
+    }
+
+    report("push (generic pointer)", now_ns() - start, n, n * sizeof(void *));
+    g_sink = (double)(uintptr_t)vec_generic_get(&v, n - 1);
+    vec_generic_destroy(&v, NULL);
+}
+
+static void bench_push_n(const size_t n)
+{
+    const size_t batch_size = 4096;
+    int *batch = (int *)malloc(sizeof(int) * batch_size);
+
+    for (size_t i = 0; i < batch_size; i++)
+    {
+        batch[i] = (int)i;
+    }
+
+    vector_bench_int_t v;
+    vec_bench_int_init(&v, 16, 2.0);
+
+    const double start = now_ns();
+
+    for (size_t appended = 0; appended < n; appended += batch_size)
+    {
+        vec_bench_int_push_n(&v, batch, batch_size);
+    }
+
+    report("push_n (4k int batches)", now_ns() - start, n, n * sizeof(int));
+    g_sink = (double)vec_bench_int_get(&v, 0);
+    vec_bench_int_destroy(&v, NULL);
+    free(batch);
+}
+
+static void scan_accumulate(double value, size_t index)
+{
+    (void)index;
+    g_sink = g_sink + value;
+}
+
+static void bench_for_each(const size_t n)
+{
+    vector_bench_f64_t v;
+    vec_bench_f64_init(&v, n, 2.0);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        vec_bench_f64_push(&v, (double)i);
+    }
+
+    const double start = now_ns();
+    vec_bench_f64_for_each(&v, scan_accumulate);
+    report("for_each scan (f64)", now_ns() - start, n, n * sizeof(double));
+    vec_bench_f64_destroy(&v, NULL);
+}
+
+static void bench_growth(const size_t n, const double growth_factor)
+{
+    vector_bench_int_t v;
+    vec_bench_int_init(&v, 16, growth_factor);
+
+    const double start = now_ns();
+
+    for (size_t i = 0; i < n; i++)
+    {
+        vec_bench_int_push(&v, (int)i);
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "growth (factor %.2f)", growth_factor);
+    report(name, now_ns() - start, n, 0);
+    g_sink = (double)vec_bench_int_capacity(&v);
+    vec_bench_int_destroy(&v, NULL);
+}
+
+static void bench_get_checked_vs_raw(const size_t n)
+{
+    vector_bench_f64_t v;
+    vec_bench_f64_init(&v, n, 2.0);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        vec_bench_f64_push(&v, (double)i);
+    }
+
+    double start = now_ns();
+    double sum = 0.0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        sum += vec_bench_f64_get(&v, i);
+    }
+
+    g_sink = sum;
+    report("get (bounds-checked)", now_ns() - start, n, n * sizeof(double));
+
+    start = now_ns();
+    sum = 0.0;
+    const double *raw = vec_bench_f64_data(&v);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        sum += raw[i];
+    }
+
+    g_sink = sum;
+    report("get (raw pointer)", now_ns() - start, n, n * sizeof(double));
+    vec_bench_f64_destroy(&v, NULL);
+}
+
+int main(const int argc, const char **argv)
+{
+    size_t n = 1000000;
+
+    if (argc > 1)
+    {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+
+        if (n == 0)
+        {
+            fprintf(stderr, "Usage: %s [element_count]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("vector_bench: %zu elements per run\n\n", n);
+
+    bench_push_int(n);
+    bench_push_record(n);
+    bench_push_generic(n);
+    bench_push_n(n);
+    bench_for_each(n);
+    bench_growth(n, 1.5);
+    bench_growth(n, 2.0);
+    bench_growth(n, 3.0);
+    bench_get_checked_vs_raw(n);
+
+    return 0;
+}